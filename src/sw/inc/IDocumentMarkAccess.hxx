@@ -255,6 +255,15 @@ class IDocumentMarkAccess
 
         virtual void assureSortedMarkContainers() const = 0;
 
+        /** Starts inserting many marks, e.g. during import.
+
+            Until the matching endBulkInsert(), created marks are collected and
+            sorted into the mark sequences at once, when the marks are accessed
+            the next time.
+        */
+        virtual void startBulkInsert() =0;
+        virtual void endBulkInsert() =0;
+
         /** returns a STL-like random access iterator to the begin of the sequence of marks.
         */
         virtual const_iterator_t getAllMarksBegin() const =0;
@@ -28,6 +28,7 @@ class WeakNodeContainer final : public SvtListener
 {
 private:
     SwNode* m_pNode;
+    bool m_bModified;
 
 public:
     WeakNodeContainer(SwNode* pNode);
@@ -39,12 +40,31 @@ public:
     /// Returns the pointer of the node or nullptr if the node
     /// got deleted.
     SwNode* getNode();
+
+    /// Was the node changed since the last resetModified() call?
+    bool isModified() const { return m_bModified; }
+    void resetModified() { m_bModified = false; }
+
+    virtual void Notify(const SfxHint& rHint) override;
 };
 
 class OnlineAccessibilityCheck
 {
 private:
-    std::map<SwNode*, std::unique_ptr<WeakNodeContainer>> m_aNodes;
+    /// Result of the last check of a node.
+    struct NodeEntry
+    {
+        std::unique_ptr<WeakNodeContainer> m_pWeakNode;
+        /// Number of issues found in the node.
+        sal_Int32 m_nIssues = 0;
+        /// Formats and drawing objects change stamp of the document at the time of the check,
+        /// as the anchored objects don't notify their anchor node.
+        sal_uInt64 m_nFormatStamp = 0;
+    };
+
+    std::map<SwNode*, NodeEntry> m_aNodes;
+    /// Nodes change stamp of the document, when m_aNodes was cleaned up the last time.
+    sal_uInt32 m_nNodesStamp;
 
     SwDoc& m_rDocument;
     sw::AccessibilityCheck m_aAccessibilityCheck;
@@ -58,6 +78,10 @@ private:
     void runAccessibilityCheck(SwNode* pNode);
     void updateStatusbar();
     void updateNodeStatus(SwNode* pContentNode, bool bIssueObjectNameChanged = false);
+    void removeNodeStatus(SwNode* pNode);
+    void removeDeletedNodes();
+    bool isNodeStatusOutdated(SwNode* pNode);
+    sal_uInt64 getFormatStamp() const;
     void initialCheck();
     void lookForPreviousNodeAndUpdate(SwPosition const& rNewPos);
     void clearAccessibilityIssuesFromAllNodes();
@@ -69,7 +93,7 @@ public:
     void resetAndQueue(SwNode* pNode, bool bIssueObjectNameChanged = false);
     void resetAndQueueDocumentLevel();
     void updateCheckerActivity();
-    sal_Int32 getNumberOfAccessibilityIssues() { return m_nAccessibilityIssues; }
+    sal_Int32 getNumberOfAccessibilityIssues();
     sal_Int32 getNumberOfDocumentLevelAccessibilityIssues()
     {
         return m_pDocumentAccessibilityIssues ? m_pDocumentAccessibilityIssues->getIssues().size()
@@ -0,0 +1,62 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This file is part of the LibreOffice project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <o3tl/enumarray.hxx>
+#include <sal/types.h>
+
+namespace sw
+{
+/// Parts of the document model, which are changed independently of each other.
+enum class ContentChange
+{
+    BodyText, ///< text of a paragraph in the body, except of headings
+    OtherText, ///< text of a paragraph in a header, footer, footnote or fly frame
+    Outline, ///< text or level of a heading, or the outline nodes
+    Nodes, ///< nodes were inserted, moved or removed
+    Layout, ///< content frames were created or destroyed
+    Hints, ///< text attributes were inserted or removed
+    Formats, ///< frame, table or section formats were created, changed or destroyed
+    Marks, ///< bookmarks and other marks were created, renamed, moved or removed
+    Fields, ///< the content of a field was changed
+    Redlines, ///< tracked changes were created or removed
+    DrawObjects, ///< drawing objects were changed
+    LAST = DrawObjects
+};
+
+/**
+ * Change counters for the parts of the document model.
+ *
+ * Views presenting an overview of the document (like the Navigator) remember
+ * the counters they depend on, and only have to collect their data again if
+ * one of them changed in the meantime.
+ */
+class ContentChangeStamps
+{
+    o3tl::enumarray<ContentChange, sal_uInt32> m_aStamps;
+
+public:
+    ContentChangeStamps() { m_aStamps.fill(0); }
+
+    void Changed(ContentChange eChange) { ++m_aStamps[eChange]; }
+    sal_uInt32 Get(ContentChange eChange) const { return m_aStamps[eChange]; }
+
+    /// Changes whenever any of the counters changes.
+    sal_uInt64 GetTotal() const
+    {
+        sal_uInt64 nTotal = 0;
+        for (sal_uInt32 nStamp : m_aStamps)
+            nTotal += nStamp;
+        return nTotal;
+    }
+};
+}
+
+/* vim:set shiftwidth=4 softtabstop=4 expandtab: */
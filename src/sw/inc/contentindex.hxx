@@ -32,27 +32,46 @@ class SwRangeRedline;
 
 namespace sw::mark { class IMark; }
 
+/// A run of consecutive SwContentIndex registered at one SwContentIndexReg.
+/// The members store their position relative to m_nOffset, so that
+/// SwContentIndexReg::Update() can shift all of them at once.
+struct SwContentIndexGroup
+{
+    SwContentIndex * m_pFirst;
+    SwContentIndex * m_pLast;
+    sal_Int32 m_nOffset;
+    sal_Int32 m_nCount;
+    /// members owned by cross-reference bookmarks, these are not shifted
+    sal_Int32 m_nCrossRefMarks;
+};
+
 /// Marks a character position inside a document model content node (SwContentNode)
 class SAL_WARN_UNUSED SW_DLLPUBLIC SwContentIndex
 {
 private:
     friend class SwContentIndexReg;
 
+    /// position, relative to the offset of m_pGroup
     sal_Int32 m_nIndex;
     SwContentNode * m_pContentNode;
     // doubly linked list of Indexes registered at m_pIndexReg
     SwContentIndex * m_pNext;
     SwContentIndex * m_pPrev;
+    SwContentIndexGroup * m_pGroup;
 
     /// points to the SwRangeRedline (if any) that contains this SwContentIndex, via SwPosition and SwPaM
     SwRangeRedline * m_pRangeRedline = nullptr;
 
     /// Pointer to a mark that owns this position to allow fast lookup of marks of an SwContentIndexReg.
     const sw::mark::IMark* m_pMark;
+    /// m_pMark is a cross-reference bookmark
+    bool m_bCrossRefMark;
 
     SwContentIndex& ChgValue( const SwContentIndex& rIdx, sal_Int32 nNewValue );
     void Init(sal_Int32 const nIdx);
     void Remove();
+    void JoinGroup(sal_Int32 nValue);
+    void LeaveGroup();
 
 public:
     explicit SwContentIndex(const SwContentNode * pContentNode, sal_Int32 const nIdx = 0);
@@ -75,26 +94,26 @@ public:
     bool operator> ( const SwContentIndex& ) const;
     bool operator>=( const SwContentIndex& ) const;
 
-    bool operator< ( sal_Int32 const nVal ) const { return m_nIndex <  nVal; }
-    bool operator<=( sal_Int32 const nVal ) const { return m_nIndex <= nVal; }
-    bool operator> ( sal_Int32 const nVal ) const { return m_nIndex >  nVal; }
-    bool operator>=( sal_Int32 const nVal ) const { return m_nIndex >= nVal; }
-    bool operator==( sal_Int32 const nVal ) const { return m_nIndex == nVal; }
-    bool operator!=( sal_Int32 const nVal ) const { return m_nIndex != nVal; }
+    bool operator< ( sal_Int32 const nVal ) const { return GetIndex() <  nVal; }
+    bool operator<=( sal_Int32 const nVal ) const { return GetIndex() <= nVal; }
+    bool operator> ( sal_Int32 const nVal ) const { return GetIndex() >  nVal; }
+    bool operator>=( sal_Int32 const nVal ) const { return GetIndex() >= nVal; }
+    bool operator==( sal_Int32 const nVal ) const { return GetIndex() == nVal; }
+    bool operator!=( sal_Int32 const nVal ) const { return GetIndex() != nVal; }
 
     bool operator==( const SwContentIndex& rSwContentIndex ) const
     {
-        return (m_nIndex    == rSwContentIndex.m_nIndex)
+        return (GetIndex() == rSwContentIndex.GetIndex())
             && (m_pContentNode == rSwContentIndex.m_pContentNode);
     }
 
     bool operator!=( const SwContentIndex& rSwContentIndex ) const
     {
-        return (m_nIndex    != rSwContentIndex.m_nIndex)
+        return (GetIndex() != rSwContentIndex.GetIndex())
             || (m_pContentNode != rSwContentIndex.m_pContentNode);
     }
 
-    sal_Int32 GetIndex() const { return m_nIndex; }
+    sal_Int32 GetIndex() const { return m_pGroup ? m_nIndex + m_pGroup->m_nOffset : m_nIndex; }
 
     // Assignments without creating a temporary object.
     SwContentIndex &Assign(const SwContentNode *, sal_Int32);
@@ -151,54 +170,54 @@ namespace o3tl
 
 inline sal_Int32 SwContentIndex::operator++()
 {
-    return ChgValue( *this, m_nIndex+1 ).m_nIndex;
+    return ChgValue( *this, GetIndex()+1 ).GetIndex();
 }
 
 inline sal_Int32 SwContentIndex::operator--()
 {
-    return ChgValue( *this, m_nIndex-1 ).m_nIndex;
+    return ChgValue( *this, GetIndex()-1 ).GetIndex();
 }
 
 inline sal_Int32 SwContentIndex::operator--(int)
 {
-    sal_Int32 const nOldIndex = m_nIndex;
-    ChgValue( *this, m_nIndex-1 );
+    sal_Int32 const nOldIndex = GetIndex();
+    ChgValue( *this, GetIndex()-1 );
     return nOldIndex;
 }
 
 inline sal_Int32 SwContentIndex::operator+=( sal_Int32 const nVal )
 {
-    return ChgValue( *this, m_nIndex + nVal ).m_nIndex;
+    return ChgValue( *this, GetIndex() + nVal ).GetIndex();
 }
 
 inline sal_Int32 SwContentIndex::operator-=( sal_Int32 const nVal )
 {
-    return ChgValue( *this, m_nIndex - nVal ).m_nIndex;
+    return ChgValue( *this, GetIndex() - nVal ).GetIndex();
 }
 
 inline bool SwContentIndex::operator< ( const SwContentIndex& rIndex ) const
 {
-    return m_nIndex <  rIndex.m_nIndex;
+    return GetIndex() <  rIndex.GetIndex();
 }
 
 inline bool SwContentIndex::operator<=( const SwContentIndex& rIndex ) const
 {
-    return m_nIndex <= rIndex.m_nIndex;
+    return GetIndex() <= rIndex.GetIndex();
 }
 
 inline bool SwContentIndex::operator> ( const SwContentIndex& rIndex ) const
 {
-    return m_nIndex >  rIndex.m_nIndex;
+    return GetIndex() >  rIndex.GetIndex();
 }
 
 inline bool SwContentIndex::operator>=( const SwContentIndex& rIndex ) const
 {
-    return m_nIndex >= rIndex.m_nIndex;
+    return GetIndex() >= rIndex.GetIndex();
 }
 
 inline SwContentIndex& SwContentIndex::operator= ( sal_Int32 const nVal )
 {
-    if (m_nIndex != nVal)
+    if (GetIndex() != nVal)
     {
         ChgValue( *this, nVal );
     }
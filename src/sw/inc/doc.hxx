@@ -38,6 +38,7 @@
 #include "charfmt.hxx"
 #include "docary.hxx"
 #include "charformats.hxx"
+#include "contentchange.hxx"
 #include "pagedesc.hxx"
 #include "tblenum.hxx"
 #include "ndarr.hxx"
@@ -201,6 +202,7 @@ class SwDoc final
     friend void FinitCore();
 
     // private Member
+    sw::ContentChangeStamps m_aContentChangeStamps; //< what changed in the nodes and formats
     std::unique_ptr<SwNodes> m_pNodes;    //< document content (Nodes Array)
     rtl::Reference<SwAttrPool> mpAttrPool;  //< the attribute pool
     SwPageDescs              m_PageDescs; //< PageDescriptors
@@ -422,6 +424,9 @@ public:
     SwNodes      & GetNodes()       { return *m_pNodes; }
     SwNodes const& GetNodes() const { return *m_pNodes; }
 
+    sw::ContentChangeStamps& GetContentChangeStamps() { return m_aContentChangeStamps; }
+    const sw::ContentChangeStamps& GetContentChangeStamps() const { return m_aContentChangeStamps; }
+
 private:
     friend class ::rtl::Reference<SwDoc>;
 
@@ -542,6 +547,7 @@ public:
     // Our own 'IdleTimer' calls the following method
     IDocumentTimerAccess const & getIDocumentTimerAccess() const;
     IDocumentTimerAccess & getIDocumentTimerAccess();
+    ::sw::DocumentTimerManager & GetDocumentTimerManager();
 
     // IDocumentChartDataProviderAccess
     IDocumentChartDataProviderAccess const & getIDocumentChartDataProviderAccess() const;
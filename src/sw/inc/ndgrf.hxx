@@ -46,6 +46,7 @@ class SAL_DLLPUBLIC_RTTI SwGrfNode final: public SwNoTextNode
     bool mbChangeTwipSize           :1;
     bool mbFrameInPaint          :1; ///< To avoid Start-/EndActions in Paint via SwapIn.
     bool mbScaleImageMap         :1; ///< Scale image map in SetTwipSize.
+    bool mbGraphicPainted        :1; ///< The graphic was loaded and painted to a window once.
 
     std::shared_ptr< SwAsyncRetrieveInputStreamThreadConsumer > mpThreadConsumer;
     bool mbLinkedInputStreamReady;
@@ -103,6 +104,9 @@ public:
     bool IsScaleImageMap() const         { return mbScaleImageMap; }
     void SetScaleImageMap( bool b )      { mbScaleImageMap = b; }
 
+    bool IsGraphicPainted() const        { return mbGraphicPainted; }
+    void SetGraphicPainted( bool b )     { mbGraphicPainted = b; }
+
     /// in ndcopy.cxx
     virtual SwContentNode* MakeCopy(SwDoc&, SwNode&, bool bNewFrames) const override;
 
@@ -131,6 +131,8 @@ private:
     bool MergePortions( SwTextNode& rNode );
 
     void Insert(SwTextAttr* pHt);
+    /// Insert many hints, sorting each array once instead of once per hint.
+    void Insert(const std::vector<SwTextAttr*>& rHints);
     SW_DLLPUBLIC void Resort() const;
     SW_DLLPUBLIC void ResortStartMap() const;
     SW_DLLPUBLIC void ResortEndMap() const;
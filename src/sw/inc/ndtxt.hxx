@@ -102,6 +102,14 @@ struct ParagraphIdleData
     bool bAutoComplDirty = true;               ///< auto complete list dirty
 };
 
+/// A range of character attributes, for inserting many of them at once.
+struct CharAttrSpan
+{
+    sal_Int32 nStart;
+    sal_Int32 nEnd;
+    const SfxItemSet* pSet; ///< character attributes (RES_CHRATR_*) only
+};
+
 } // end namespace sw
 
 /// SwTextNode is a paragraph in the document model.
@@ -325,6 +333,20 @@ public:
     /// Insert pAttr into hints array. @return true iff inserted successfully
     bool    InsertHint( SwTextAttr * const pAttr,
                   const SetAttrMode nMode = SetAttrMode::DEFAULT );
+    /** Insert a batch of character attribute spans, e.g. while importing
+        HTML (see SwHTMLParser::SetAttr_).
+
+        The result is the same as calling SetAttr() for each span in order:
+        later spans override earlier ones, and with SetAttrMode::DONTREPLACE
+        the attributes already set win, just as they do against existing
+        hints. Overlapping spans are cut into portions in one sweep, one
+        automatic style is created per portion and all of them are added to
+        the hints array at once. If the spans can't be handled that way
+        (e.g. they overlap existing character formats), they are set one by
+        one with SetAttr().
+        @return true iff any attribute was set */
+    bool    InsertCharAttrSpans( const std::vector<sw::CharAttrSpan>& rSpans,
+                  const SetAttrMode nMode = SetAttrMode::DEFAULT );
     /// create new text attribute from rAttr and insert it
     /// @return     inserted hint; 0 if not sure the hint is inserted
     SwTextAttr* InsertItem( SfxPoolItem& rAttr,
@@ -69,6 +69,12 @@ public:
     typedef std::vector<SwTableLine*>::iterator iterator;
     typedef std::vector<SwTableLine*>::const_iterator const_iterator;
 
+private:
+    /// Position found by the last GetPos() call: rows are mostly inserted,
+    /// deleted or visited one after the other, so the next one is close to it.
+    mutable size_type m_nLastPos = 0;
+
+public:
     // free's any remaining child objects
     ~SwTableLines();
 
@@ -97,8 +103,20 @@ public:
     // return USHRT_MAX if not found, else index of position
     sal_uInt16 GetPos(const SwTableLine* pBox) const
     {
+        const size_type nSize = m_vLines.size();
+        for (size_type nPos : { m_nLastPos, m_nLastPos + 1, m_nLastPos - 1 })
+        {
+            if (nPos < nSize && m_vLines[nPos] == pBox)
+            {
+                m_nLastPos = nPos;
+                return nPos;
+            }
+        }
         const_iterator it = std::find(begin(), end(), pBox);
-        return it == end() ? USHRT_MAX : it - begin();
+        if (it == end())
+            return USHRT_MAX;
+        m_nLastPos = it - begin();
+        return m_nLastPos;
     }
 };
 
@@ -0,0 +1,34 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This file is part of the LibreOffice project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <sal/types.h>
+#include "swdllapi.h"
+
+namespace sw
+{
+/// Counters of the cache of paragraph portions shared by all documents, to size it.
+struct TextCacheStatistics
+{
+    sal_uInt64 m_nHits = 0; ///< a frame found its paragraph portion in the cache
+    sal_uInt64 m_nMisses = 0; ///< a frame's paragraph portion was no longer in the cache
+    sal_uInt64 m_nReformats = 0; ///< formatted frames formatted again, as their portion was evicted
+    sal_uInt16 m_nBudget = 0; ///< see SetTextCacheBudget()
+    sal_uInt16 m_nMaxEntries = 0; ///< current maximum number of cached paragraphs
+};
+
+SW_DLLPUBLIC TextCacheStatistics GetTextCacheStatistics();
+
+/// Sets the number of paragraphs cached in addition to the ones on the visible pages
+/// (250 by default). Takes effect when the cache is resized for the next paint.
+SW_DLLPUBLIC void SetTextCacheBudget(sal_uInt16 nBudget);
+}
+
+/* vim:set shiftwidth=4 softtabstop=4 expandtab: */
@@ -105,6 +105,16 @@ struct SwVisiblePageNumbers
     OUString sFirstCustomVirt, sLastCustomVirt;
 };
 
+/// Statistics of the tile invalidations sent to the LibreOfficeKit client of a view.
+struct SwLOKInvalidationStats
+{
+    sal_uInt64 nFlushes = 0;    ///< flushes that invalidated something, i.e. edits
+    sal_uInt64 nCollected = 0;  ///< rectangles collected from all views
+    sal_uInt64 nSent = 0;       ///< rectangles sent after merging
+    sal_uInt64 nTiles = 0;      ///< 256px tiles (at 100% zoom) covered by the sent rectangles
+    sal_uInt64 nLastTiles = 0;  ///< tiles invalidated by the last flush
+};
+
 class SwView;
 
 class SAL_DLLPUBLIC_RTTI SwViewShell : public sw::Ring<SwViewShell>
@@ -168,6 +178,8 @@ class SAL_DLLPUBLIC_RTTI SwViewShell : public sw::Ring<SwViewShell>
 
     SwRootFramePtr            mpLayout;
 
+    SwLOKInvalidationStats    maLOKInvalidationStats;
+
     // Initialization; called by the diverse constructors.
     void Init( const SwViewOption *pNewOpt );
 
@@ -239,6 +251,7 @@ public:
 
     void InvalidateWindows( const SwRect &rRect );
     void FlushPendingLOKInvalidateTiles();
+    const SwLOKInvalidationStats& GetLOKInvalidationStats() const { return maLOKInvalidationStats; }
 
     /// Invalidates complete Layout (ApplyViewOption).
     SW_DLLPUBLIC void Reformat();
@@ -11,6 +11,7 @@
 
 #include <hintids.hxx>
 #include <frame.hxx>
+#include <frmtool.hxx>
 #include <swcache.hxx>
 
 using namespace sw;
@@ -38,6 +39,7 @@ void BorderCacheOwner::InvalidateInSwCache(const sal_uInt16 nWhich)
         case RES_FRM_SIZE:
         case RES_KEEP:
         case RES_BREAK:
+            InvalidateTabFrameBorderLines();
             if (m_bInCache)
             {
                 SwFrame::GetCache().Delete(this);
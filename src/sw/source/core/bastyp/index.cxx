@@ -24,12 +24,20 @@
 
 #include <crossrefbookmark.hxx>
 
+namespace
+{
+/// Number of indexes of a group before it is split in two.
+constexpr sal_Int32 CONTENT_INDEX_GROUP_SIZE = 64;
+}
+
 SwContentIndex::SwContentIndex(const SwContentNode * pContentNode, sal_Int32 const nIdx)
     : m_nIndex( nIdx )
     , m_pContentNode( const_cast<SwContentNode*>(pContentNode) )
     , m_pNext( nullptr )
     , m_pPrev( nullptr )
+    , m_pGroup( nullptr )
     , m_pMark( nullptr )
+    , m_bCrossRefMark( false )
 {
     Init(m_nIndex);
 }
@@ -38,19 +46,23 @@ SwContentIndex::SwContentIndex( const SwContentIndex& rIdx, short nDiff )
     : m_pContentNode( rIdx.m_pContentNode )
     , m_pNext( nullptr )
     , m_pPrev( nullptr )
+    , m_pGroup( nullptr )
     , m_pMark( nullptr )
+    , m_bCrossRefMark( false )
 {
-    ChgValue( rIdx, rIdx.m_nIndex + nDiff );
+    ChgValue( rIdx, rIdx.GetIndex() + nDiff );
 }
 
 SwContentIndex::SwContentIndex( const SwContentIndex& rIdx )
-    : m_nIndex( rIdx.m_nIndex )
+    : m_nIndex( rIdx.GetIndex() )
     , m_pContentNode( rIdx.m_pContentNode )
     , m_pNext( nullptr )
     , m_pPrev( nullptr )
+    , m_pGroup( nullptr )
     , m_pMark( nullptr )
+    , m_bCrossRefMark( false )
 {
-    ChgValue( rIdx, rIdx.m_nIndex );
+    ChgValue( rIdx, rIdx.GetIndex() );
 }
 
 void SwContentIndex::Init(sal_Int32 const nIdx)
@@ -63,10 +75,10 @@ void SwContentIndex::Init(sal_Int32 const nIdx)
     {
         assert(!m_pContentNode->m_pLast);
         m_pContentNode->m_pFirst = m_pContentNode->m_pLast = this;
-        m_nIndex = nIdx;
+        JoinGroup(nIdx);
     }
-    else if (nIdx > ((m_pContentNode->m_pLast->m_nIndex
-                        - m_pContentNode->m_pFirst->m_nIndex) / 2))
+    else if (nIdx > ((m_pContentNode->m_pLast->GetIndex()
+                        - m_pContentNode->m_pFirst->GetIndex()) / 2))
     {
         ChgValue( *m_pContentNode->m_pLast, nIdx );
     }
@@ -85,12 +97,12 @@ SwContentIndex& SwContentIndex::ChgValue( const SwContentIndex& rIdx, sal_Int32
         return *this; // no IndexReg => no list to sort into; m_nIndex is 0
     }
     SwContentIndex* pFnd = const_cast<SwContentIndex*>(&rIdx);
-    if (rIdx.m_nIndex > nNewValue) // move forwards
+    if (rIdx.GetIndex() > nNewValue) // move forwards
     {
         for (;;)
         {
             SwContentIndex* pPrv = pFnd->m_pPrev;
-            if (!pPrv || pPrv->m_nIndex <= nNewValue)
+            if (!pPrv || pPrv->GetIndex() <= nNewValue)
                 break;
             pFnd = pPrv;
         }
@@ -109,12 +121,12 @@ SwContentIndex& SwContentIndex::ChgValue( const SwContentIndex& rIdx, sal_Int32
             pFnd->m_pPrev = this;
         }
     }
-    else if (rIdx.m_nIndex < nNewValue)
+    else if (rIdx.GetIndex() < nNewValue)
     {
         for (;;)
         {
             SwContentIndex* pNxt = pFnd->m_pNext;
-            if (!pNxt || pNxt->m_nIndex >= nNewValue)
+            if (!pNxt || pNxt->GetIndex() >= nNewValue)
                 break;
             pFnd = pNxt;
         }
@@ -153,7 +165,11 @@ SwContentIndex& SwContentIndex::ChgValue( const SwContentIndex& rIdx, sal_Int32
     if (m_pContentNode->m_pLast == m_pPrev)
         m_pContentNode->m_pLast = this;
 
-    m_nIndex = nNewValue;
+    // Remove() left the group if the index moved in the list
+    if (m_pGroup)
+        m_nIndex = nNewValue - m_pGroup->m_nOffset;
+    else
+        JoinGroup(nNewValue);
 
     return *this;
 }
@@ -166,6 +182,8 @@ void SwContentIndex::Remove()
         return;
     }
 
+    LeaveGroup();
+
     if (m_pPrev)
     {
         m_pPrev->m_pNext = m_pNext;
@@ -185,6 +203,80 @@ void SwContentIndex::Remove()
     }
 }
 
+/// Joins the group of a neighbour in the list (or a new group), after being
+/// linked into the list of the node.
+void SwContentIndex::JoinGroup(sal_Int32 const nValue)
+{
+    assert(!m_pGroup);
+    SwContentIndexGroup* pGroup = m_pPrev ? m_pPrev->m_pGroup : m_pNext ? m_pNext->m_pGroup : nullptr;
+    if (!pGroup)
+    {
+        pGroup = new SwContentIndexGroup{ this, this, 0, 0, 0 };
+    }
+    else if (!m_pPrev)
+    {
+        pGroup->m_pFirst = this;
+    }
+    else if (pGroup->m_pLast == m_pPrev)
+    {
+        pGroup->m_pLast = this;
+    }
+
+    m_pGroup = pGroup;
+    m_nIndex = nValue - pGroup->m_nOffset;
+    ++pGroup->m_nCount;
+    if (m_bCrossRefMark)
+        ++pGroup->m_nCrossRefMarks;
+
+    if (pGroup->m_nCount <= CONTENT_INDEX_GROUP_SIZE)
+        return;
+
+    // split the group; the new one gets the same offset, so the positions of
+    // the moved indexes stay valid
+    SwContentIndex* pIdx = pGroup->m_pFirst;
+    for (sal_Int32 n = pGroup->m_nCount / 2; n; --n)
+        pIdx = pIdx->m_pNext;
+    SwContentIndexGroup* pNewGroup
+        = new SwContentIndexGroup{ pIdx, pGroup->m_pLast, pGroup->m_nOffset, 0, 0 };
+    pGroup->m_pLast = pIdx->m_pPrev;
+    for (;;)
+    {
+        pIdx->m_pGroup = pNewGroup;
+        ++pNewGroup->m_nCount;
+        --pGroup->m_nCount;
+        if (pIdx->m_bCrossRefMark)
+        {
+            ++pNewGroup->m_nCrossRefMarks;
+            --pGroup->m_nCrossRefMarks;
+        }
+        if (pIdx == pNewGroup->m_pLast)
+            break;
+        pIdx = pIdx->m_pNext;
+    }
+}
+
+/// Leaves the group, before being unlinked from the list of the node.
+void SwContentIndex::LeaveGroup()
+{
+    SwContentIndexGroup* const pGroup = m_pGroup;
+    if (!pGroup)
+        return;
+
+    m_nIndex += pGroup->m_nOffset;
+    m_pGroup = nullptr;
+    if (--pGroup->m_nCount == 0)
+    {
+        delete pGroup;
+        return;
+    }
+    if (m_bCrossRefMark)
+        --pGroup->m_nCrossRefMarks;
+    if (pGroup->m_pFirst == this)
+        pGroup->m_pFirst = m_pNext;
+    if (pGroup->m_pLast == this)
+        pGroup->m_pLast = m_pPrev;
+}
+
 SwContentIndex& SwContentIndex::operator=( const SwContentIndex& rIdx )
 {
     bool bEqual;
@@ -196,10 +288,10 @@ SwContentIndex& SwContentIndex::operator=( const SwContentIndex& rIdx )
         bEqual = false;
     }
     else
-        bEqual = rIdx.m_nIndex == m_nIndex;
+        bEqual = rIdx.GetIndex() == GetIndex();
 
     if( !bEqual )
-        ChgValue( rIdx, rIdx.m_nIndex );
+        ChgValue( rIdx, rIdx.GetIndex() );
     return *this;
 }
 
@@ -212,7 +304,7 @@ SwContentIndex& SwContentIndex::Assign( const SwContentNode* pArr, sal_Int32 nId
         m_pNext = m_pPrev = nullptr;
         Init(nIdx);
     }
-    else if (m_nIndex != nIdx)
+    else if (GetIndex() != nIdx)
     {
         ChgValue( *this, nIdx );
     }
@@ -222,6 +314,15 @@ SwContentIndex& SwContentIndex::Assign( const SwContentNode* pArr, sal_Int32 nId
 void SwContentIndex::SetMark(const sw::mark::IMark* pMark)
 {
     m_pMark = pMark;
+    // HACK: the positions of cross-ref bookmarks are not updated, see
+    // SwContentIndexReg::Update()
+    const bool bCrossRefMark
+        = pMark && dynamic_cast<::sw::mark::CrossRefBookmark const*>(pMark) != nullptr;
+    if (bCrossRefMark == m_bCrossRefMark)
+        return;
+    m_bCrossRefMark = bCrossRefMark;
+    if (m_pGroup)
+        m_pGroup->m_nCrossRefMarks += bCrossRefMark ? 1 : -1;
 }
 
 SwContentIndexReg::SwContentIndexReg()
@@ -239,44 +340,52 @@ void SwContentIndexReg::Update(
     const sal_Int32 nDiff,
     UpdateMode const eMode)
 {
+    // Moves pIdx and all indexes after it by nShift; groups starting at or
+    // after pIdx are moved at once by changing their offset.
+    auto const aShiftFrom = [](SwContentIndex* pIdx, sal_Int32 const nShift, bool const bSkipCrossRefMarks)
+    {
+        while (pIdx)
+        {
+            SwContentIndexGroup* const pGroup = pIdx->m_pGroup;
+            if (pIdx == pGroup->m_pFirst && !(bSkipCrossRefMarks && pGroup->m_nCrossRefMarks))
+            {
+                pGroup->m_nOffset += nShift;
+                pIdx = pGroup->m_pLast->m_pNext;
+            }
+            else
+            {
+                if (!bSkipCrossRefMarks || !pIdx->m_bCrossRefMark)
+                    pIdx->m_nIndex += nShift;
+                pIdx = pIdx->m_pNext;
+            }
+        }
+    };
+
     SwContentIndex* pStt = const_cast<SwContentIndex*>(&rIdx);
-    const sal_Int32 nNewVal = rIdx.m_nIndex;
+    const sal_Int32 nNewVal = rIdx.GetIndex();
     if (eMode & UpdateMode::Negative)
     {
-        const sal_Int32 nLast = rIdx.m_nIndex + nDiff;
+        const sal_Int32 nLast = nNewVal + nDiff;
         pStt = rIdx.m_pNext;
         // skip over the ones that already have the right value
-        while (pStt && pStt->m_nIndex == nNewVal)
+        while (pStt && pStt->GetIndex() == nNewVal)
             pStt = pStt->m_pNext;
-        while (pStt && pStt->m_nIndex <= nLast)
-        {
-            pStt->m_nIndex = nNewVal;
-            pStt = pStt->m_pNext;
-        }
-        while( pStt )
+        while (pStt && pStt->GetIndex() <= nLast)
         {
-            pStt->m_nIndex = pStt->m_nIndex - nDiff;
+            pStt->m_nIndex = nNewVal - pStt->m_pGroup->m_nOffset;
             pStt = pStt->m_pNext;
         }
+        aShiftFrom(pStt, -nDiff, false);
     }
     else
     {
-        while (pStt && pStt->m_nIndex == nNewVal)
+        while (pStt && pStt->GetIndex() == nNewVal)
         {
             pStt->m_nIndex = pStt->m_nIndex + nDiff;
             pStt = pStt->m_pPrev;
         }
-        pStt = rIdx.m_pNext;
-        while( pStt )
-        {
-            // HACK: avoid updating position of cross-ref bookmarks
-            if (!pStt->m_pMark || nullptr == dynamic_cast<
-                    ::sw::mark::CrossRefBookmark const*>(pStt->m_pMark))
-            {
-                pStt->m_nIndex = pStt->m_nIndex + nDiff;
-            }
-            pStt = pStt->m_pNext;
-        }
+        // HACK: avoid updating position of cross-ref bookmarks
+        aShiftFrom(rIdx.m_pNext, nDiff, true);
     }
 }
 
@@ -303,75 +412,75 @@ void SwContentIndexReg::MoveTo( SwContentNode& rArr )
 
 sal_Int32 SwContentIndex::operator++()
 {
-    SAL_WARN_IF( !(m_nIndex < SAL_MAX_INT32), "sw.core",
+    SAL_WARN_IF( !(GetIndex() < SAL_MAX_INT32), "sw.core",
                  "SwContentIndex::operator++() wraps around" );
 
-    ChgValue( *this, m_nIndex+1 );
-    return m_nIndex;
+    ChgValue( *this, GetIndex()+1 );
+    return GetIndex();
 }
 
 sal_Int32 SwContentIndex::operator--(int)
 {
-    SAL_WARN_IF( !(m_nIndex > 0), "sw.core",
+    SAL_WARN_IF( !(GetIndex() > 0), "sw.core",
                  "SwContentIndex::operator--(int) wraps around" );
 
-    const sal_Int32 nOldIndex = m_nIndex;
-    ChgValue( *this, m_nIndex-1 );
+    const sal_Int32 nOldIndex = GetIndex();
+    ChgValue( *this, GetIndex()-1 );
     return nOldIndex;
 }
 
 sal_Int32 SwContentIndex::operator--()
 {
-    SAL_WARN_IF( !( m_nIndex > 0), "sw.core",
+    SAL_WARN_IF( !( GetIndex() > 0), "sw.core",
                  "SwContentIndex::operator--() wraps around" );
-    return ChgValue( *this, m_nIndex-1 ).m_nIndex;
+    return ChgValue( *this, GetIndex()-1 ).GetIndex();
 }
 
 sal_Int32 SwContentIndex::operator+=( sal_Int32 const nVal )
 {
-    SAL_WARN_IF( !(nVal > 0 ? m_nIndex <= SAL_MAX_INT32 - nVal : m_nIndex >= nVal), "sw.core",
+    SAL_WARN_IF( !(nVal > 0 ? GetIndex() <= SAL_MAX_INT32 - nVal : GetIndex() >= nVal), "sw.core",
                  "SwContentIndex SwContentIndex::operator+=(sal_Int32) wraps around" );
-    return ChgValue( *this, m_nIndex + nVal ).m_nIndex;
+    return ChgValue( *this, GetIndex() + nVal ).GetIndex();
 }
 
 sal_Int32 SwContentIndex::operator-=( sal_Int32 const nVal )
 {
-    SAL_WARN_IF( !(m_nIndex >= nVal), "sw.core",
+    SAL_WARN_IF( !(GetIndex() >= nVal), "sw.core",
                  "SwContentIndex::operator-=(sal_Int32) wraps around" );
-    return ChgValue( *this, m_nIndex - nVal ).m_nIndex;
+    return ChgValue( *this, GetIndex() - nVal ).GetIndex();
 }
 
 bool SwContentIndex::operator< ( const SwContentIndex & rIndex ) const
 {
     // Attempt to compare indices into different arrays
     assert(m_pContentNode == rIndex.m_pContentNode);
-    return m_nIndex < rIndex.m_nIndex;
+    return GetIndex() < rIndex.GetIndex();
 }
 
 bool SwContentIndex::operator<=( const SwContentIndex & rIndex ) const
 {
     // Attempt to compare indices into different arrays
     assert(m_pContentNode == rIndex.m_pContentNode);
-    return m_nIndex <= rIndex.m_nIndex;
+    return GetIndex() <= rIndex.GetIndex();
 }
 
 bool SwContentIndex::operator> ( const SwContentIndex & rIndex ) const
 {
     // Attempt to compare indices into different arrays
     assert(m_pContentNode == rIndex.m_pContentNode);
-    return m_nIndex > rIndex.m_nIndex;
+    return GetIndex() > rIndex.GetIndex();
 }
 
 bool SwContentIndex::operator>=( const SwContentIndex & rIndex ) const
 {
     // Attempt to compare indices into different arrays
     assert(m_pContentNode == rIndex.m_pContentNode);
-    return m_nIndex >= rIndex.m_nIndex;
+    return GetIndex() >= rIndex.GetIndex();
 }
 
 SwContentIndex& SwContentIndex::operator= ( sal_Int32 const nVal )
 {
-    if (m_nIndex != nVal)
+    if (GetIndex() != nVal)
         ChgValue( *this, nVal );
 
     return *this;
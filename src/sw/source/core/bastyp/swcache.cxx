@@ -145,6 +145,18 @@ void SwCache::DecreaseMax( const sal_uInt16 nSub )
 #endif
 }
 
+void SwCache::ShrinkToMax()
+{
+    SwCacheObj *pObj = m_pLast;
+    while ( pObj && m_nCurMax < (m_aCacheObjects.size() - m_aFreePositions.size()) )
+    {
+        SwCacheObj *const pPrev = pObj->GetPrev();
+        if ( !pObj->IsLocked() )
+            DeleteObj( pObj );
+        pObj = pPrev;
+    }
+}
+
 void SwCache::Flush()
 {
     INCREMENT( m_nFlushCnt );
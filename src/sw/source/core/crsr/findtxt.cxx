@@ -17,11 +17,14 @@
  *   the License at http://www.apache.org/licenses/LICENSE-2.0 .
  */
 
+#include <algorithm>
 #include <memory>
 
 //#include <com/sun/star/util/SearchFlags.hpp>
 //#include <com/sun/star/util/SearchResult.hpp>
 #include <comphelper/lok.hxx>
+#include <i18nutil/searchopt.hxx>
+#include <i18nutil/transliteration.hxx>
 #include <o3tl/safeint.hxx>
 #include <rtl/ustrbuf.hxx>
 #include <svx/svdview.hxx>
@@ -718,6 +721,41 @@ bool FindTextImpl(SwPaM & rSearchPam,
 
 } // namespace sw
 
+/// Quick check, if a plain (not regex/wildcard/similarity) search string may
+/// occur in rText at all. It only rejects text consisting of ASCII characters,
+/// which are neither removed by lcl_CleanStr() nor affected by the allowed
+/// transliterations, so that no match gets lost.
+static bool lcl_MayContain(const OUString& rText, const i18nutil::SearchOptions2& rSearchOpt)
+{
+    if (SearchAlgorithms2::ABSOLUTE != rSearchOpt.AlgorithmType2)
+        return true;
+
+    const TransliterationFlags eAllowedFlags = TransliterationFlags::IGNORE_CASE
+                                               | TransliterationFlags::IGNORE_WIDTH
+                                               | TransliterationFlags::IGNORE_KASHIDA_CTL
+                                               | TransliterationFlags::IGNORE_DIACRITICS_CTL;
+    if (rSearchOpt.transliterateFlags & ~eAllowedFlags)
+        return true;
+
+    const OUString& rSearch = rSearchOpt.searchString;
+    auto const isPlainAscii = [](sal_Unicode c) { return c < 0x80 && c != CH_TXTATR_BREAKWORD; };
+    if (!std::all_of(rSearch.getStr(), rSearch.getStr() + rSearch.getLength(), isPlainAscii)
+        || !std::all_of(rText.getStr(), rText.getStr() + rText.getLength(), isPlainAscii))
+    {
+        return true;
+    }
+
+    if (!(rSearchOpt.transliterateFlags & TransliterationFlags::IGNORE_CASE))
+        return rText.indexOf(rSearch) != -1;
+
+    for (sal_Int32 nPos = 0; nPos + rSearch.getLength() <= rText.getLength(); ++nPos)
+    {
+        if (rText.matchIgnoreAsciiCase(rSearch, nPos))
+            return true;
+    }
+    return false;
+}
+
 bool DoSearch(SwPaM & rSearchPam,
         const i18nutil::SearchOptions2& rSearchOpt, utl::TextSearch& rSText,
                       SwMoveFnCollection const & fnMove, bool bSrchForward, bool bRegSearch,
@@ -745,6 +783,11 @@ bool DoSearch(SwPaM & rSearchPam,
             return false;
     }
 
+    // Avoid cleaning up the text and calling the text search for paragraphs,
+    // which can't contain the search string
+    if (!lcl_MayContain(pLayout ? pFrame->GetText() : pNode->GetText(), rSearchOpt))
+        return false;
+
     bool bFound = false;
     OUString sCleanStr;
     std::vector<AmbiguousIndex> aFltArr;
@@ -506,6 +506,8 @@ bool DocumentFieldsManager::UpdateField(SwTextField* pDstTextField, SwField& rSr
     if (pDstField->GetTyp()->Which() ==
         rSrcField.GetTyp()->Which())
     {
+        m_rDoc.GetContentChangeStamps().Changed(sw::ContentChange::Fields);
+
         if (m_rDoc.GetIDocumentUndoRedo().DoesUndo())
         {
             SwPosition aPosition( pDstTextField->GetTextNode(), pDstTextField->GetStart() );
@@ -32,10 +32,20 @@
 #include <docsh.hxx>
 #include <docfld.hxx>
 #include <fldbas.hxx>
+#include <ndgrf.hxx>
+#include <vcl/graphicfilter.hxx>
 #include <vcl/scheduler.hxx>
 #include <comphelper/lok.hxx>
 #include <editsh.hxx>
 
+#include <algorithm>
+
+namespace
+{
+/// Number of graphics decoded (in parallel) by one idle job, which waits for all of them.
+constexpr size_t GRAPHIC_SWAPIN_BATCH = 8;
+}
+
 namespace sw
 {
 DocumentTimerManager::DocumentTimerManager(SwDoc& i_rSwdoc)
@@ -101,6 +111,42 @@ void DocumentTimerManager::UnblockIdling()
     }
 }
 
+void DocumentTimerManager::QueueGraphicSwapIn(SwGrfNode& rNode)
+{
+    if (std::find(m_aGraphicSwapIns.begin(), m_aGraphicSwapIns.end(), &rNode)
+        == m_aGraphicSwapIns.end())
+        m_aGraphicSwapIns.push_back(&rNode);
+    StartIdling();
+}
+
+void DocumentTimerManager::CancelGraphicSwapIn(const SwGrfNode& rNode)
+{
+    std::erase(m_aGraphicSwapIns, &rNode);
+    m_aFailedGraphicSwapIns.erase(&rNode);
+}
+
+void DocumentTimerManager::SwapInGraphics()
+{
+    const auto itEnd
+        = m_aGraphicSwapIns.begin() + std::min(m_aGraphicSwapIns.size(), GRAPHIC_SWAPIN_BATCH);
+    std::vector<SwGrfNode*> aNodes(m_aGraphicSwapIns.begin(), itEnd);
+    m_aGraphicSwapIns.erase(m_aGraphicSwapIns.begin(), itEnd);
+
+    std::vector<Graphic*> aGraphics;
+    for (SwGrfNode* pNode : aNodes)
+        aGraphics.push_back(const_cast<Graphic*>(&pNode->GetGrfObj().GetGraphic()));
+    GraphicFilter::GetGraphicFilter().MakeGraphicsAvailableThreaded(aGraphics);
+
+    for (size_t i = 0; i < aNodes.size(); ++i)
+    {
+        // the threaded import may skip some; failed ones are painted as
+        // before, otherwise each repaint would queue them again
+        if (!aGraphics[i]->isAvailable() && !aGraphics[i]->makeAvailable())
+            m_aFailedGraphicSwapIns.insert(aNodes[i]);
+        aNodes[i]->TriggerGraphicArrived();
+    }
+}
+
 IMPL_LINK(DocumentTimerManager, FireIdleJobsTimeout, Timer*, , void)
 {
     // Now we can run the idle jobs, assuming we finished LOK initialization.
@@ -118,6 +164,9 @@ DocumentTimerManager::IdleJob DocumentTimerManager::GetNextIdleJob() const
             if( rSh.ActionPend() )
                 return IdleJob::Busy;
 
+        if (!m_aGraphicSwapIns.empty())
+            return IdleJob::Graphics;
+
         if( pTmpRoot->IsNeedGrammarCheck() )
         {
             bool bIsOnlineSpell = pShell->GetViewOptions()->IsOnlineSpell();
@@ -165,6 +214,10 @@ IMPL_LINK_NOARG( DocumentTimerManager, DoIdleJobs, Timer*, void )
 
     switch ( eJob )
     {
+    case IdleJob::Graphics:
+        SwapInGraphics();
+        break;
+
     case IdleJob::Grammar:
         m_rDoc.StartGrammarChecking();
         break;
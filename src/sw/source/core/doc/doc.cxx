@@ -272,6 +272,11 @@ IDocumentTimerAccess & SwDoc::getIDocumentTimerAccess()
     return *m_pDocumentTimerManager;
 }
 
+::sw::DocumentTimerManager & SwDoc::GetDocumentTimerManager()
+{
+    return *m_pDocumentTimerManager;
+}
+
 // IDocumentLinksAdministration
 IDocumentLinksAdministration const & SwDoc::getIDocumentLinksAdministration() const
 {
@@ -17,6 +17,7 @@
  *   the License at http://www.apache.org/licenses/LICENSE-2.0 .
  */
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -414,7 +415,7 @@ namespace
     }
 
     MarkManager::container_t::const_iterator lcl_FindMark(
-        MarkManager::container_t& rMarks,
+        const MarkManager::container_t& rMarks,
         const ::sw::mark::MarkBase *const pMarkToFind)
     {
         auto ppCurrentMark = lower_bound(
@@ -464,13 +465,59 @@ namespace
 
     MarkManager::container_t::const_iterator lcl_FindMarkByName(
         const OUString& rName,
-        const MarkManager::container_t::const_iterator& ppMarksBegin,
-        const MarkManager::container_t::const_iterator& ppMarksEnd)
+        const MarkManager::container_t& rMarks,
+        const MarkNameIndex_t& rIndex)
     {
-        return find_if(
-            ppMarksBegin,
-            ppMarksEnd,
-            [&rName] (::sw::mark::MarkBase const*const pMark) { return pMark->GetName() == rName; } );
+        auto const [itName, itNameEnd] = rIndex.equal_range(rName);
+        if (itName == itNameEnd)
+            return rMarks.end();
+        if (std::next(itName) != itNameEnd)
+        {
+            // several marks with this name (UNO marks are not checked): the
+            // first one in rMarks wins
+            return find_if(
+                rMarks.begin(),
+                rMarks.end(),
+                [&rName] (::sw::mark::MarkBase const*const pMark) { return pMark->GetName() == rName; } );
+        }
+        auto const ppMark = lcl_FindMark(rMarks, itName->second);
+        if (ppMark != rMarks.end())
+            return ppMark;
+        // not in rMarks, or rMarks is not sorted right now
+        return find(rMarks.begin(), rMarks.end(), itName->second);
+    }
+
+    void lcl_RemoveFromNameIndex(MarkNameIndex_t& rIndex, const ::sw::mark::MarkBase* pMark)
+    {
+        auto [itName, itNameEnd] = rIndex.equal_range(pMark->GetName());
+        for ( ; itName != itNameEnd; ++itName)
+        {
+            if (itName->second == pMark)
+            {
+                rIndex.erase(itName);
+                return;
+            }
+        }
+        assert(false && "mark not found in name index");
+    }
+
+    /// merges the sorted rNewMarks into the sorted rMarks
+    void lcl_MergeMarks(MarkManager::container_t& rMarks, const MarkManager::container_t& rNewMarks)
+    {
+        if (rNewMarks.size() == 1)
+        {
+            lcl_InsertMarkSorted(rMarks, rNewMarks.front());
+            return;
+        }
+        if (rNewMarks.empty())
+            return;
+        MarkManager::container_t vMerged;
+        vMerged.reserve(rMarks.size() + rNewMarks.size());
+        // std::merge puts rNewMarks first on equal start positions, like
+        // lcl_InsertMarkSorted() does
+        merge(rNewMarks.begin(), rNewMarks.end(), rMarks.begin(), rMarks.end(),
+            back_inserter(vMerged), &lcl_MarkOrderingByStart);
+        rMarks.swap(vMerged);
     }
 
     void lcl_DebugMarks(MarkManager::container_t const& rMarks)
@@ -561,7 +608,8 @@ void IDocumentMarkAccess::DeleteFieldmarkCommand(::sw::mark::IFieldmark const& r
 namespace sw::mark
 {
     MarkManager::MarkManager(SwDoc& rDoc)
-        : m_rDoc(rDoc)
+        : m_nBulkInsertLevel(0)
+        , m_rDoc(rDoc)
         , m_pLastActiveFieldmark(nullptr)
     { }
 
@@ -598,12 +646,15 @@ namespace sw::mark
             return nullptr;
         }
         // There should only be one CrossRefBookmark per Textnode per Type
-        if ((eType == MarkType::CROSSREF_NUMITEM_BOOKMARK || eType == MarkType::CROSSREF_HEADING_BOOKMARK)
-            && (lcl_FindMarkAtPos(m_vBookmarks, *rPaM.Start(), eType) != m_vBookmarks.end()))
-        {   // this can happen via UNO API
-            SAL_WARN("sw.core", "MarkManager::makeMark(..)"
-                " - refusing to create duplicate CrossRefBookmark");
-            return nullptr;
+        if (eType == MarkType::CROSSREF_NUMITEM_BOOKMARK || eType == MarkType::CROSSREF_HEADING_BOOKMARK)
+        {
+            assureNoPendingMarks();
+            if (lcl_FindMarkAtPos(m_vBookmarks, *rPaM.Start(), eType) != m_vBookmarks.end())
+            {   // this can happen via UNO API
+                SAL_WARN("sw.core", "MarkManager::makeMark(..)"
+                    " - refusing to create duplicate CrossRefBookmark");
+                return nullptr;
+            }
         }
 
         if ((eType == MarkType::CHECKBOX_FIELDMARK || eType == MarkType::DROPDOWN_FIELDMARK)
@@ -687,30 +738,15 @@ namespace sw::mark
         // insert any dummy chars before inserting into sorted vectors
         pMark->InitDoc(m_rDoc, eMode, pSepPos);
 
-        // register mark
-        lcl_InsertMarkSorted(m_vAllMarks, pMark.get());
-        switch(eType)
-        {
-            case IDocumentMarkAccess::MarkType::BOOKMARK:
-            case IDocumentMarkAccess::MarkType::CROSSREF_NUMITEM_BOOKMARK:
-            case IDocumentMarkAccess::MarkType::CROSSREF_HEADING_BOOKMARK:
-                lcl_InsertMarkSorted(m_vBookmarks, pMark.get());
-                break;
-            case IDocumentMarkAccess::MarkType::TEXT_FIELDMARK:
-            case IDocumentMarkAccess::MarkType::CHECKBOX_FIELDMARK:
-            case IDocumentMarkAccess::MarkType::DROPDOWN_FIELDMARK:
-            case IDocumentMarkAccess::MarkType::DATE_FIELDMARK:
-                lcl_InsertMarkSorted(m_vFieldmarks, pMark.get());
-                break;
-            case IDocumentMarkAccess::MarkType::ANNOTATIONMARK:
-                lcl_InsertMarkSorted( m_vAnnotationMarks, pMark.get() );
-                break;
-            case IDocumentMarkAccess::MarkType::NAVIGATOR_REMINDER:
-            case IDocumentMarkAccess::MarkType::DDE_BOOKMARK:
-            case IDocumentMarkAccess::MarkType::UNO_BOOKMARK:
-                // no special array for these
-                break;
-        }
+        m_rDoc.GetContentChangeStamps().Changed(sw::ContentChange::Marks);
+
+        // register mark; during bulk insertion the containers are sorted
+        // lazily, see insertPendingMarks()
+        m_aMarkNameIndex.emplace(pMark->GetName(), pMark.get());
+        m_vPendingMarks.push_back(pMark.get());
+        if (!m_nBulkInsertLevel)
+            insertPendingMarks();
+
         if (eMode == InsertMode::New
             && (eType == IDocumentMarkAccess::MarkType::TEXT_FIELDMARK
                 || eType == IDocumentMarkAccess::MarkType::DATE_FIELDMARK))
@@ -830,6 +866,8 @@ namespace sw::mark
         const SwTextNode& rTextNode,
         const IDocumentMarkAccess::MarkType eType )
     {
+        assureNoPendingMarks();
+
         SwPosition aPos(rTextNode);
         auto const ppExistingMark = lcl_FindMarkAtPos(m_vBookmarks, aPos, eType);
         if(ppExistingMark != m_vBookmarks.end())
@@ -850,6 +888,8 @@ namespace sw::mark
         ::sw::mark::IMark* const io_pMark,
         const SwPaM& rPaM)
     {
+        assureNoPendingMarks();
+
         assert(&io_pMark->GetMarkPos().GetDoc() == &m_rDoc &&
             "<MarkManager::repositionMark(..)>"
             " - Mark is not in my doc.");
@@ -882,12 +922,15 @@ namespace sw::mark
             " - Mark is not in my doc.");
         if ( io_pMark->GetName() == rNewName )
             return true;
-        if (lcl_FindMarkByName(rNewName, m_vAllMarks.begin(), m_vAllMarks.end()) != m_vAllMarks.end())
+        if (m_aMarkNameIndex.find(rNewName) != m_aMarkNameIndex.end())
             return false;
         if (::sw::mark::MarkBase* pMarkBase = dynamic_cast< ::sw::mark::MarkBase* >(io_pMark))
         {
             const OUString sOldName(pMarkBase->GetName());
+            m_rDoc.GetContentChangeStamps().Changed(sw::ContentChange::Marks);
+            lcl_RemoveFromNameIndex(m_aMarkNameIndex, pMarkBase);
             pMarkBase->SetName(rNewName);
+            m_aMarkNameIndex.emplace(rNewName, pMarkBase);
 
             if (dynamic_cast< ::sw::mark::Bookmark* >(io_pMark))
             {
@@ -907,6 +950,8 @@ namespace sw::mark
         const SwPosition& rNewPos,
         const sal_Int32 nOffset)
     {
+        assureNoPendingMarks();
+
         const SwNode* const pOldNode = &rOldNode;
         SwPosition aNewPos(rNewPos);
         aNewPos.AdjustContent(nOffset);
@@ -950,6 +995,8 @@ namespace sw::mark
 
     void MarkManager::correctMarksRelative(const SwNode& rOldNode, const SwPosition& rNewPos, const sal_Int32 nOffset)
     {
+        assureNoPendingMarks();
+
         const SwNode* const pOldNode = &rOldNode;
         SwPosition aNewPos(rNewPos);
         aNewPos.AdjustContent(nOffset);
@@ -1072,6 +1119,8 @@ namespace sw::mark
 
     bool MarkManager::isBookmarkDeleted(SwPaM const& rPaM, bool const isReplace) const
     {
+        assureNoPendingMarks();
+
         SwPosition const& rStart(*rPaM.Start());
         SwPosition const& rEnd(*rPaM.End());
         for (auto ppMark = m_vBookmarks.begin();
@@ -1100,6 +1149,8 @@ namespace sw::mark
             std::optional<sal_Int32> oEndContentIdx,
             bool const isReplace)
     {
+        assureNoPendingMarks();
+
         std::vector<const_iterator_t> vMarksToDelete;
         bool bIsSortingNeeded = false;
 
@@ -1273,6 +1324,7 @@ namespace sw::mark
         if (ppMark.get() == m_vAllMarks.end())
             return ret;
         IMark* pMark = *ppMark;
+        m_rDoc.GetContentChangeStamps().Changed(sw::ContentChange::Marks);
 
         switch(IDocumentMarkAccess::GetType(*pMark))
         {
@@ -1358,6 +1410,7 @@ namespace sw::mark
             ret.reset(new LazyDdeBookmarkDeleter(pDdeBookmark, m_rDoc));
         }
 
+        lcl_RemoveFromNameIndex(m_aMarkNameIndex, *aI);
         m_vAllMarks.erase(aI);
         // If we don't have a lazy deleter
         if (!ret)
@@ -1372,6 +1425,7 @@ namespace sw::mark
         assert(&pMark->GetMarkPos().GetDoc() == &m_rDoc &&
             "<MarkManager::deleteMark(..)>"
             " - Mark is not in my doc.");
+        assureNoPendingMarks();
         // finds the last Mark that is starting before pMark
         // (pMarkLow < pMark)
         auto [it, endIt] = equal_range(
@@ -1389,10 +1443,14 @@ namespace sw::mark
 
     void MarkManager::clearAllMarks()
     {
+        assureNoPendingMarks();
+
+        m_rDoc.GetContentChangeStamps().Changed(sw::ContentChange::Marks);
         ClearFieldActivation();
         m_vFieldmarks.clear();
         m_vBookmarks.clear();
         m_vAnnotationMarks.clear();
+        m_aMarkNameIndex.clear();
         for (const auto & p : m_vAllMarks)
             delete p;
         m_vAllMarks.clear();
@@ -1400,19 +1458,25 @@ namespace sw::mark
 
     IDocumentMarkAccess::const_iterator_t MarkManager::findMark(const OUString& rName) const
     {
-        auto const ret = lcl_FindMarkByName(rName, m_vAllMarks.begin(), m_vAllMarks.end());
+        assureNoPendingMarks();
+
+        auto const ret = lcl_FindMarkByName(rName, m_vAllMarks, m_aMarkNameIndex);
         return IDocumentMarkAccess::iterator(ret);
     }
 
     IDocumentMarkAccess::const_iterator_t MarkManager::findBookmark(const OUString& rName) const
     {
-        auto const ret = lcl_FindMarkByName(rName, m_vBookmarks.begin(), m_vBookmarks.end());
+        assureNoPendingMarks();
+
+        auto const ret = lcl_FindMarkByName(rName, m_vBookmarks, m_aMarkNameIndex);
         return IDocumentMarkAccess::iterator(ret);
     }
 
     // find the first Mark that does not start before
     IDocumentMarkAccess::const_iterator_t MarkManager::findFirstMarkNotStartsBefore(const SwPosition& rPos) const
     {
+        assureNoPendingMarks();
+
         return std::lower_bound(
                 m_vAllMarks.begin(),
                 m_vAllMarks.end(),
@@ -1421,35 +1485,65 @@ namespace sw::mark
     }
 
     IDocumentMarkAccess::const_iterator_t MarkManager::getAllMarksBegin() const
-        { return m_vAllMarks.begin(); }
+    {
+        assureNoPendingMarks();
+        return m_vAllMarks.begin();
+    }
 
     IDocumentMarkAccess::const_iterator_t MarkManager::getAllMarksEnd() const
-        { return m_vAllMarks.end(); }
+    {
+        assureNoPendingMarks();
+        return m_vAllMarks.end();
+    }
 
     sal_Int32 MarkManager::getAllMarksCount() const
-        { return m_vAllMarks.size(); }
+    {
+        assureNoPendingMarks();
+        return m_vAllMarks.size();
+    }
 
     IDocumentMarkAccess::const_iterator_t MarkManager::getBookmarksBegin() const
-        { return m_vBookmarks.begin(); }
+    {
+        assureNoPendingMarks();
+        return m_vBookmarks.begin();
+    }
 
     IDocumentMarkAccess::const_iterator_t MarkManager::getBookmarksEnd() const
-        { return m_vBookmarks.end(); }
+    {
+        assureNoPendingMarks();
+        return m_vBookmarks.end();
+    }
 
     sal_Int32 MarkManager::getBookmarksCount() const
-        { return m_vBookmarks.size(); }
+    {
+        assureNoPendingMarks();
+        return m_vBookmarks.size();
+    }
 
     IDocumentMarkAccess::const_iterator_t MarkManager::getFieldmarksBegin() const
-        { return m_vFieldmarks.begin(); }
+    {
+        assureNoPendingMarks();
+        return m_vFieldmarks.begin();
+    }
 
     IDocumentMarkAccess::const_iterator_t MarkManager::getFieldmarksEnd() const
-        { return m_vFieldmarks.end(); }
+    {
+        assureNoPendingMarks();
+        return m_vFieldmarks.end();
+    }
 
-    sal_Int32 MarkManager::getFieldmarksCount() const { return m_vFieldmarks.size(); }
+    sal_Int32 MarkManager::getFieldmarksCount() const
+    {
+        assureNoPendingMarks();
+        return m_vFieldmarks.size();
+    }
 
 
     // finds the first that is starting after
     IDocumentMarkAccess::const_iterator_t MarkManager::findFirstBookmarkStartsAfter(const SwPosition& rPos) const
     {
+        assureNoPendingMarks();
+
         return std::upper_bound(
             m_vBookmarks.begin(),
             m_vBookmarks.end(),
@@ -1459,6 +1553,8 @@ namespace sw::mark
 
     IFieldmark* MarkManager::getFieldmarkAt(const SwPosition& rPos) const
     {
+        assureNoPendingMarks();
+
         auto const pFieldmark = find_if(
             m_vFieldmarks.begin(),
             m_vFieldmarks.end(),
@@ -1475,6 +1571,8 @@ namespace sw::mark
 
     IFieldmark* MarkManager::getInnerFieldmarkFor(const SwPosition& rPos) const
     {
+        assureNoPendingMarks();
+
         auto itFieldmark = find_if(
             m_vFieldmarks.begin(),
             m_vFieldmarks.end(),
@@ -1500,6 +1598,8 @@ namespace sw::mark
 
     IMark* MarkManager::getOneInnermostBookmarkFor(const SwPosition& rPos) const
     {
+        assureNoPendingMarks();
+
         auto it = std::find_if(m_vBookmarks.begin(), m_vBookmarks.end(),
                                [&rPos](const sw::mark::MarkBase* pMark)
                                { return pMark->IsCoveringPosition(rPos); });
@@ -1637,6 +1737,8 @@ namespace sw::mark
 
     void MarkManager::LOKUpdateActiveField(const SfxViewShell* pViewShell)
     {
+        assureNoPendingMarks();
+
         if (!comphelper::LibreOfficeKit::isActive())
             return;
 
@@ -1678,6 +1780,8 @@ namespace sw::mark
 
     std::vector<IFieldmark*> MarkManager::getNoTextFieldmarksIn(const SwPaM &rPaM) const
     {
+        assureNoPendingMarks();
+
         std::vector<IFieldmark*> aRet;
 
         for (auto aI = m_vFieldmarks.begin(),
@@ -1702,34 +1806,47 @@ namespace sw::mark
     }
 
     IFieldmark* MarkManager::getFieldmarkAfter(const SwPosition& rPos, bool bLoop) const
-        { return dynamic_cast<IFieldmark*>(lcl_getMarkAfter(m_vFieldmarks, rPos, bLoop)); }
+    {
+        assureNoPendingMarks();
+        return dynamic_cast<IFieldmark*>(lcl_getMarkAfter(m_vFieldmarks, rPos, bLoop));
+    }
 
     IFieldmark* MarkManager::getFieldmarkBefore(const SwPosition& rPos, bool bLoop) const
-        { return dynamic_cast<IFieldmark*>(lcl_getMarkBefore(m_vFieldmarks, rPos, bLoop)); }
+    {
+        assureNoPendingMarks();
+        return dynamic_cast<IFieldmark*>(lcl_getMarkBefore(m_vFieldmarks, rPos, bLoop));
+    }
 
     IDocumentMarkAccess::const_iterator_t MarkManager::getAnnotationMarksBegin() const
     {
+        assureNoPendingMarks();
         return m_vAnnotationMarks.begin();
     }
 
     IDocumentMarkAccess::const_iterator_t MarkManager::getAnnotationMarksEnd() const
     {
+        assureNoPendingMarks();
         return m_vAnnotationMarks.end();
     }
 
     sal_Int32 MarkManager::getAnnotationMarksCount() const
     {
+        assureNoPendingMarks();
         return m_vAnnotationMarks.size();
     }
 
     IDocumentMarkAccess::const_iterator_t MarkManager::findAnnotationMark( const OUString& rName ) const
     {
-        auto const ret = lcl_FindMarkByName( rName, m_vAnnotationMarks.begin(), m_vAnnotationMarks.end() );
+        assureNoPendingMarks();
+
+        auto const ret = lcl_FindMarkByName( rName, m_vAnnotationMarks, m_aMarkNameIndex );
         return IDocumentMarkAccess::iterator(ret);
     }
 
     IMark* MarkManager::getAnnotationMarkFor(const SwPosition& rPos) const
     {
+        assureNoPendingMarks();
+
         auto const pAnnotationMark = find_if(
             m_vAnnotationMarks.begin(),
             m_vAnnotationMarks.end(),
@@ -1742,6 +1859,8 @@ namespace sw::mark
     // finds the first that is starting after
     IDocumentMarkAccess::const_iterator_t MarkManager::findFirstAnnotationStartsAfter(const SwPosition& rPos) const
     {
+        assureNoPendingMarks();
+
         return std::upper_bound(
             m_vAnnotationMarks.begin(),
             m_vAnnotationMarks.end(),
@@ -1808,11 +1927,11 @@ namespace sw::mark
         {
             OUString newName = rName + "MailMergeMark"
                     + DateTimeToOUString( DateTime( DateTime::SYSTEM ) )
-                    + OUString::number( m_vAllMarks.size() + 1 );
+                    + OUString::number( m_vAllMarks.size() + m_vPendingMarks.size() + 1 );
             return newName;
         }
 
-        if (lcl_FindMarkByName(rName, m_vAllMarks.begin(), m_vAllMarks.end()) == m_vAllMarks.end())
+        if (m_aMarkNameIndex.find(rName) == m_aMarkNameIndex.end())
         {
             return rName;
         }
@@ -1830,7 +1949,7 @@ namespace sw::mark
         {
             sTmp = aPrefix + OUString::number(nCnt);
             nCnt++;
-            if (lcl_FindMarkByName(sTmp, m_vAllMarks.begin(), m_vAllMarks.end()) == m_vAllMarks.end())
+            if (m_aMarkNameIndex.find(sTmp) == m_aMarkNameIndex.end())
             {
                 break;
             }
@@ -1842,9 +1961,69 @@ namespace sw::mark
 
     void MarkManager::assureSortedMarkContainers() const
     {
+        assureNoPendingMarks();
         const_cast< MarkManager* >(this)->sortMarks();
     }
 
+    void MarkManager::startBulkInsert()
+    {
+        ++m_nBulkInsertLevel;
+    }
+
+    void MarkManager::endBulkInsert()
+    {
+        assert(m_nBulkInsertLevel && "<MarkManager::endBulkInsert()> - no bulk insertion");
+        if (--m_nBulkInsertLevel == 0)
+            assureNoPendingMarks();
+    }
+
+    void MarkManager::insertPendingMarks()
+    {
+        container_t vNewMarks;
+        vNewMarks.swap(m_vPendingMarks);
+        if (vNewMarks.size() > 1)
+        {
+            // a mark inserted one by one goes before the marks with the same
+            // start position, so the later created marks come first
+            std::reverse(vNewMarks.begin(), vNewMarks.end());
+            stable_sort(vNewMarks.begin(), vNewMarks.end(), &lcl_MarkOrderingByStart);
+        }
+
+        container_t vNewBookmarks;
+        container_t vNewFieldmarks;
+        container_t vNewAnnotationMarks;
+        for (MarkBase* const pMark : vNewMarks)
+        {
+            switch(IDocumentMarkAccess::GetType(*pMark))
+            {
+                case IDocumentMarkAccess::MarkType::BOOKMARK:
+                case IDocumentMarkAccess::MarkType::CROSSREF_NUMITEM_BOOKMARK:
+                case IDocumentMarkAccess::MarkType::CROSSREF_HEADING_BOOKMARK:
+                    vNewBookmarks.push_back(pMark);
+                    break;
+                case IDocumentMarkAccess::MarkType::TEXT_FIELDMARK:
+                case IDocumentMarkAccess::MarkType::CHECKBOX_FIELDMARK:
+                case IDocumentMarkAccess::MarkType::DROPDOWN_FIELDMARK:
+                case IDocumentMarkAccess::MarkType::DATE_FIELDMARK:
+                    vNewFieldmarks.push_back(pMark);
+                    break;
+                case IDocumentMarkAccess::MarkType::ANNOTATIONMARK:
+                    vNewAnnotationMarks.push_back(pMark);
+                    break;
+                case IDocumentMarkAccess::MarkType::NAVIGATOR_REMINDER:
+                case IDocumentMarkAccess::MarkType::DDE_BOOKMARK:
+                case IDocumentMarkAccess::MarkType::UNO_BOOKMARK:
+                    // no special array for these
+                    break;
+            }
+        }
+
+        lcl_MergeMarks(m_vAllMarks, vNewMarks);
+        lcl_MergeMarks(m_vBookmarks, vNewBookmarks);
+        lcl_MergeMarks(m_vFieldmarks, vNewFieldmarks);
+        lcl_MergeMarks(m_vAnnotationMarks, vNewAnnotationMarks);
+    }
+
     void MarkManager::sortSubsetMarks()
     {
         stable_sort(m_vBookmarks.begin(), m_vBookmarks.end(), &lcl_MarkOrderingByStart);
@@ -1854,12 +2033,15 @@ namespace sw::mark
 
     void MarkManager::sortMarks()
     {
+        m_rDoc.GetContentChangeStamps().Changed(sw::ContentChange::Marks);
         sort(m_vAllMarks.begin(), m_vAllMarks.end(), &lcl_MarkOrderingByStart);
         sortSubsetMarks();
     }
 
 void MarkManager::dumpAsXml(xmlTextWriterPtr pWriter) const
 {
+    assureNoPendingMarks();
+
     struct
     {
         const char* pName;
@@ -430,6 +430,7 @@ bool SwRedlineTable::Insert(SwRangeRedline*& p)
         std::pair<vector_type::const_iterator, bool> rv = maVector.insert( p );
         size_type nP = rv.first - begin();
         LOKRedlineNotification(RedlineNotification::Add, p);
+        p->GetDoc().GetContentChangeStamps().Changed(sw::ContentChange::Redlines);
 
         // detect text moving by checking nearby redlines, except during Undo
         // (apply isMoved() during OpenDocument and DOCX import, too, to fix
@@ -484,6 +485,7 @@ bool SwRedlineTable::Insert(SwRangeRedline*& p, size_type& rP)
     {
         std::pair<vector_type::const_iterator, bool> rv = maVector.insert( p );
         rP = rv.first - begin();
+        p->GetDoc().GetContentChangeStamps().Changed(sw::ContentChange::Redlines);
         p->CallDisplayFunc(rP);
         if (rv.second)
         {
@@ -687,6 +689,7 @@ void SwRedlineTable::Remove( const SwRangeRedline* p )
 void SwRedlineTable::Remove( size_type nP )
 {
     LOKRedlineNotification(RedlineNotification::Remove, maVector[nP]);
+    maVector[nP]->GetDoc().GetContentChangeStamps().Changed(sw::ContentChange::Redlines);
     SwDoc* pDoc = nullptr;
     if( !nP && 1 == size() )
         pDoc = &maVector.front()->GetDoc();
@@ -723,6 +726,7 @@ void SwRedlineTable::DeleteAndDestroy(size_type const nP)
         mpMaxEndPos = nullptr;
     maVector.erase(maVector.begin() + nP);
     LOKRedlineNotification(RedlineNotification::Remove, pRedline);
+    pRedline->GetDoc().GetContentChangeStamps().Changed(sw::ContentChange::Redlines);
     delete pRedline;
 }
 
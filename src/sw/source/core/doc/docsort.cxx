@@ -47,7 +47,8 @@
 #include <frameformats.hxx>
 #include <svl/numformat.hxx>
 
-#include <set>
+#include <algorithm>
+#include <numeric>
 #include <utility>
 
 using namespace ::com::sun::star::lang;
@@ -135,8 +136,8 @@ int SwSortElement::keycompare(const SwSortElement& rCmp, sal_uInt16 nKey) const
 
     if( rSrtKey.bIsNumeric )
     {
-        double n1 = pOrig->GetValue( nKey );
-        double n2 = pCmp->GetValue( nKey );
+        double n1 = pOrig->aKeyValues[ nKey ];
+        double n2 = pCmp->aKeyValues[ nKey ];
 
         nCmp = n1 < n2 ? -1 : n1 == n2 ? 0 : 1;
     }
@@ -151,13 +152,29 @@ int SwSortElement::keycompare(const SwSortElement& rCmp, sal_uInt16 nKey) const
         }
 
         nCmp = pSortCollator->compareString(
-                    pOrig->GetKey( nKey ), pCmp->GetKey( nKey ));
+                    pOrig->aKeyTexts[ nKey ], pCmp->aKeyTexts[ nKey ]);
     }
     return nCmp;
 }
 
+void SwSortElement::CacheKeys()
+{
+    const size_t nKeys = pOptions->aKeys.size();
+    aKeyTexts.resize( nKeys );
+    aKeyValues.resize( nKeys );
+    for( size_t nKey = 0; nKey < nKeys; ++nKey )
+    {
+        if( pOptions->aKeys[ nKey ].bIsNumeric )
+            aKeyValues[ nKey ] = GetValue( nKey );
+        else
+            aKeyTexts[ nKey ] = GetKey( nKey );
+    }
+}
+
 bool SwSortElement::operator<(const SwSortElement& rCmp) const
 {
+    assert(aKeyTexts.size() == pOptions->aKeys.size() && "Who forgot to call CacheKeys?");
+
     // The actual comparison
     for(size_t nKey = 0; nKey < pOptions->aKeys.size(); ++nKey)
     {
@@ -279,6 +296,20 @@ double SwSortBoxElement::GetValue( sal_uInt16 nKey ) const
     return nVal;
 }
 
+namespace
+{
+/// Stable order of the elements, which all have their keys cached
+template<class T> std::vector<size_t> lcl_SortOrder(const std::vector<T>& rElements)
+{
+    std::vector<size_t> aOrder(rElements.size());
+    std::iota(aOrder.begin(), aOrder.end(), 0);
+    std::stable_sort(aOrder.begin(), aOrder.end(),
+                     [&rElements](size_t nLeft, size_t nRight)
+                     { return rElements[nLeft] < rElements[nRight]; });
+    return aOrder;
+}
+}
+
 /// Sort Text in the Document
 bool SwDoc::SortText(const SwPaM& rPaM, const SwSortOptions& rOpt)
 {
@@ -368,13 +399,16 @@ bool SwDoc::SortText(const SwPaM& rPaM, const SwSortOptions& rOpt)
 
     SwNodeIndex aStart(pStart->GetNode());
     SwSortElement::Init( this, rOpt );
-    std::multiset<SwSortTextElement> aSortSet;
+    std::vector<SwSortTextElement> aSortList;
+    aSortList.reserve( sal_Int32(pEnd->GetNodeIndex() - pStart->GetNodeIndex()) + 1 );
     while( aStart <= pEnd->GetNode() )
     {
         // Iterate over a selected range
-        aSortSet.insert(SwSortTextElement(aStart));
+        aSortList.emplace_back(aStart);
+        aSortList.back().CacheKeys();
         ++aStart;
     }
+    const std::vector<size_t> aOrder = lcl_SortOrder( aSortList );
 
     // Now comes the tricky part: Move Nodes (and always keep Undo in mind)
     SwNodeOffset nBeg = pStart->GetNodeIndex();
@@ -389,25 +423,37 @@ bool SwDoc::SortText(const SwPaM& rPaM, const SwSortOptions& rOpt)
     GetIDocumentUndoRedo().DoUndo(false);
 
     SwNodeOffset n(0);
-    for (const auto& rElem : aSortSet)
+    for (size_t i = 0; i < aOrder.size(); )
     {
-        aStart      = nBeg + n;
-        aRg.aStart  = rElem.aPos.GetIndex();
-        aRg.aEnd    = aRg.aStart.GetIndex() + 1;
-
-        // Move Nodes
-        getIDocumentContentOperations().MoveNodeRange( aRg, aStart.GetNode(),
-            SwMoveFlags::DEFAULT );
+        // Paragraphs which follow each other in the sorted order and are
+        // still adjacent in the document are moved together
+        const SwNodeOffset nRgStart = aSortList[aOrder[i]].aPos.GetIndex();
+        SwNodeOffset nRgLen(0);
+        do
+        {
+            // Insert Move in Undo
+            if(pUndoSort)
+            {
+                pUndoSort->Insert(aSortList[aOrder[i]].nOrg, nBeg + n + nRgLen);
+            }
+            ++nRgLen;
+            ++i;
+        }
+        while( i < aOrder.size() && aSortList[aOrder[i]].aPos.GetIndex() == nRgStart + nRgLen );
 
-        // Insert Move in Undo
-        if(pUndoSort)
+        // Move Nodes, unless they are already in place
+        if( nRgStart != nBeg + n )
         {
-            pUndoSort->Insert(rElem.nOrg, nBeg + n);
+            aStart      = nBeg + n;
+            aRg.aStart  = nRgStart;
+            aRg.aEnd    = nRgStart + nRgLen;
+            getIDocumentContentOperations().MoveNodeRange( aRg, aStart.GetNode(),
+                SwMoveFlags::DEFAULT );
         }
-        ++n;
+        n += nRgLen;
     }
     // Delete all elements from the SortArray
-    aSortSet.clear();
+    aSortList.clear();
     SwSortElement::Finit();
 
     if( pRedlPam )
@@ -540,19 +586,23 @@ bool SwDoc::SortTable(const SwSelBoxes& rBoxes, const SwSortOptions& rOpt)
 
     // Sort SortList by Key
     SwSortElement::Init( this, rOpt, &aFlatBox );
-    std::multiset<SwSortBoxElement> aSortList;
+    std::vector<SwSortBoxElement> aSortList;
+    aSortList.reserve( nCount - nStart );
 
     // When sorting, do not include the first row if the HeaderLine is repeated
     for( sal_uInt16 i = o3tl::narrowing<sal_uInt16>(nStart); i < nCount; ++i)
     {
-        aSortList.insert(SwSortBoxElement(i));
+        aSortList.emplace_back(i);
+        aSortList.back().CacheKeys();
     }
+    const std::vector<size_t> aOrder = lcl_SortOrder( aSortList );
 
     // Move after Sorting
     SwMovedBoxes aMovedList;
     sal_uInt16 i = 0;
-    for (const auto& rElem : aSortList)
+    for (size_t nElem : aOrder)
     {
+        const SwSortBoxElement& rElem = aSortList[nElem];
         if(rOpt.eDirection == SwSortDirection::Rows)
         {
             MoveRow(this, aFlatBox, rElem.nRow, i+nStart, aMovedList, pUndoSort);
@@ -713,6 +713,7 @@ bool SwDoc::SetTOXBaseName(const SwTOXBase& rTOXBase, const OUString& rName)
     {
         pTOX->SetTOXName(rName);
         pTOX->SetSectionName(rName);
+        GetContentChangeStamps().Changed(sw::ContentChange::Formats);
         getIDocumentState().SetModified();
         return true;
     }
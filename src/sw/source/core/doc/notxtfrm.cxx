@@ -21,7 +21,9 @@
 #include <tools/urlobj.hxx>
 #include <vcl/imapobj.hxx>
 #include <vcl/imap.hxx>
+#include <vcl/svapp.hxx>
 #include <svl/urihelper.hxx>
+#include <comphelper/lok.hxx>
 #include <sfx2/progress.hxx>
 #include <sfx2/printer.hxx>
 #include <editeng/udlnitem.hxx>
@@ -37,6 +39,7 @@
 #include <IDocumentStylePoolAccess.hxx>
 #include <IDocumentDeviceAccess.hxx>
 #include <IDocumentLayoutAccess.hxx>
+#include <DocumentTimerManager.hxx>
 #include <flyfrm.hxx>
 #include <flyfrms.hxx>
 #include <frmtool.hxx>
@@ -1217,11 +1220,28 @@ void SwNoTextFrame::ImplPaintPictureGraphic( vcl::RenderContext* pOut,
             ::lcl_PaintReplacement( rAlignedGrfArea, aText, *pShell, this, false );
             bContinue = false;
         }
+        // embedded graphics, which were not loaded since the import, are loaded
+        // by an idle job (the visible ones first), paint a placeholder until
+        // then; graphics swapped out after they were shown are loaded right here
+        else if ( !pGrfNd->IsGrfLink() && !pGrfNd->IsGraphicPainted() &&
+                  !rGrfObj.GetGraphic().isAvailable() &&
+                  pShell->isOutputToWindow() &&
+                  !comphelper::LibreOfficeKit::isActive() &&
+                  !Application::IsHeadlessModeEnabled() &&
+                  !rNoTNd.GetDoc().GetDocumentTimerManager().IsGraphicSwapInFailed( *pGrfNd ) )
+        {
+            rNoTNd.GetDoc().GetDocumentTimerManager().QueueGraphicSwapIn( *pGrfNd );
+            ::lcl_PaintReplacement( rAlignedGrfArea, pGrfNd->GetTitle(), *pShell, this, false );
+            bContinue = false;
+        }
     }
 
     if( !bContinue )
         return;
 
+    if( !bPrn )
+        pGrfNd->SetGraphicPainted( true );
+
     if( !rGrfObj.GetGraphic().IsSupportedGraphic())
     {
         ImplPaintPictureReplacement(rGrfObj, pGrfNd, rAlignedGrfArea, pShell);
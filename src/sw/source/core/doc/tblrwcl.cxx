@@ -588,6 +588,10 @@ bool SwTable::InsertRow_( SwDoc* pDoc, const SwSelBoxes& rBoxes,
     else
         aCpyPara.nDelBorderFlag = 2;
 
+    // all new Lines are inserted at the same place: allocate them at once
+    SwTableLines& rInsLines = aCpyPara.pInsBox ? aCpyPara.pInsBox->GetTabLines() : GetTabLines();
+    rInsLines.reserve( rInsLines.size() + nCnt * pFndBox->GetLines().size() );
+
     assert(pDoc);
 
     for( sal_uInt16 nCpyCnt = 0; nCpyCnt < nCnt; ++nCpyCnt )
@@ -40,6 +40,8 @@ void SwNodes::UpdateOutlineNode(SwNode & rNd)
 {
     assert(IsDocNodes()); // no point in m_pOutlineNodes for undo nodes
 
+    GetDoc().GetContentChangeStamps().Changed(sw::ContentChange::Outline);
+
     SwTextNode * pTextNd = rNd.GetTextNode();
 
     if (!pTextNd || !pTextNd->IsOutlineStateChanged())
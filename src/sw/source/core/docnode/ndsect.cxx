@@ -593,6 +593,7 @@ void SwDoc::UpdateSection( size_t const nPos, SwSectionData & rNewData,
 {
     SwSectionFormat* pFormat = (*mpSectionFormatTable)[ nPos ];
     SwSection* pSection = pFormat->GetSection();
+    GetContentChangeStamps().Changed(sw::ContentChange::Formats);
 
     /// remember hidden condition flag of SwSection before changes
     bool bOldCondHidden = pSection->IsCondHidden();
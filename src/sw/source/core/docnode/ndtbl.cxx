@@ -1047,6 +1047,8 @@ SwTableNode* SwNodes::TextToTable( const SwNodeRange& rRange, sal_Unicode cCh,
 
     SwNodeIndex aSttIdx( *pTableNd, 1 );
     SwNodeIndex aEndIdx( rRange.aEnd, -1 );
+    // every TextNode becomes a Line
+    rTable.GetTabLines().reserve( sal_Int32(aEndIdx.GetIndex() - aSttIdx.GetIndex()) );
     for( nLines = 0, nBoxes = 0;
         aSttIdx.GetIndex() < aEndIdx.GetIndex();
         aSttIdx += SwNodeOffset(2), nLines++, nBoxes = 0 )
@@ -1093,51 +1095,48 @@ SwTableNode* SwNodes::TextToTable( const SwNodeRange& rRange, sal_Unicode cCh,
         SwStartNode* pSttNd;
         SwPosition aCntPos( aSttIdx, pTextNd, 0);
 
-        const std::shared_ptr< sw::mark::ContentIdxStore> pContentStore(sw::mark::ContentIdxStore::Create());
-        pContentStore->Save(rDoc, aSttIdx.GetIndex(), SAL_MAX_INT32);
+        sal_Int32 nChPos = T2T_PARA != cCh ? pTextNd->GetText().indexOf( cCh ) : -1;
 
-        if( T2T_PARA != cCh )
+        // Marks, redlines and cursors only have to be saved, if the node is
+        // split; scanning them for every single-box Line is expensive
+        std::shared_ptr< sw::mark::ContentIdxStore> pContentStore;
+        if( nChPos >= 0 )
         {
-            for (sal_Int32 nChPos = 0; nChPos < pTextNd->GetText().getLength();)
-            {
-                if (pTextNd->GetText()[nChPos] == cCh)
+            pContentStore = sw::mark::ContentIdxStore::Create();
+            pContentStore->Save(rDoc, aSttIdx.GetIndex(), SAL_MAX_INT32);
+        }
+
+        for( ; nChPos >= 0; nChPos = pTextNd->GetText().indexOf( cCh ) )
+        {
+            aCntPos.SetContent(nChPos);
+            std::function<void (SwTextNode *, sw::mark::RestoreMode, bool)> restoreFunc(
+                [&](SwTextNode *const pNewNode, sw::mark::RestoreMode const eMode, bool)
                 {
-                    aCntPos.SetContent(nChPos);
-                    std::function<void (SwTextNode *, sw::mark::RestoreMode, bool)> restoreFunc(
-                        [&](SwTextNode *const pNewNode, sw::mark::RestoreMode const eMode, bool)
-                        {
-                            if (!pContentStore->Empty())
-                            {
-                                pContentStore->Restore(*pNewNode, nChPos, nChPos + 1, eMode);
-                            }
-                        });
-                    SwContentNode *const pNewNd =
-                        pTextNd->SplitContentNode(aCntPos, &restoreFunc);
+                    if (!pContentStore->Empty())
+                    {
+                        pContentStore->Restore(*pNewNode, nChPos, nChPos + 1, eMode);
+                    }
+                });
+            SwContentNode *const pNewNd =
+                pTextNd->SplitContentNode(aCntPos, &restoreFunc);
 
-                    // Delete separator and correct search string
-                    pTextNd->EraseText( aCntPos, 1 );
-                    nChPos = 0;
+            // Delete separator, the search continues at the start of the rest
+            pTextNd->EraseText( aCntPos, 1 );
 
-                    // Set the TableNode as StartNode for all TextNodes in the Table
-                    const SwNodeIndex aTmpIdx( aCntPos.GetNode(), -1 );
-                    pSttNd = new SwStartNode( aTmpIdx.GetNode(), SwNodeType::Start,
-                                                SwTableBoxStartNode );
-                    new SwEndNode( aCntPos.GetNode(), *pSttNd );
-                    pNewNd->m_pStartOfSection = pSttNd;
+            // Set the TableNode as StartNode for all TextNodes in the Table
+            const SwNodeIndex aTmpIdx( aCntPos.GetNode(), -1 );
+            pSttNd = new SwStartNode( aTmpIdx.GetNode(), SwNodeType::Start,
+                                        SwTableBoxStartNode );
+            new SwEndNode( aCntPos.GetNode(), *pSttNd );
+            pNewNd->m_pStartOfSection = pSttNd;
 
-                    // Assign Section to the Box
-                    pBox = new SwTableBox( pBoxFormat, *pSttNd, pLine );
-                    pLine->GetTabBoxes().insert( pLine->GetTabBoxes().begin() + nBoxes++, pBox );
-                }
-                else
-                {
-                    ++nChPos;
-                }
-            }
+            // Assign Section to the Box
+            pBox = new SwTableBox( pBoxFormat, *pSttNd, pLine );
+            pLine->GetTabBoxes().insert( pLine->GetTabBoxes().begin() + nBoxes++, pBox );
         }
 
         // Now for the last substring
-        if( !pContentStore->Empty())
+        if( pContentStore && !pContentStore->Empty())
             pContentStore->Restore( *pTextNd, pTextNd->GetText().getLength(), pTextNd->GetText().getLength()+1 );
 
         pSttNd = new SwStartNode( aCntPos.GetNode(), SwNodeType::Start, SwTableBoxStartNode );
@@ -413,6 +413,8 @@ bool SwNodes::MoveNodes( const SwNodeRange& aRange, SwNodes & rNodes,
           !pCurrentNode->StartOfSectionIndex() ))
         return false;
 
+    GetDoc().GetContentChangeStamps().Changed(sw::ContentChange::Nodes);
+
     SwNodeRange aRg( aRange );
 
     // skip "simple" start or end nodes
@@ -2317,6 +2319,7 @@ void SwNodes::ForEach( SwNode& rStart, SwNode& rEnd,
 
 void SwNodes::RemoveNode( SwNodeOffset nDelPos, SwNodeOffset nSz, bool bDel )
 {
+    GetDoc().GetContentChangeStamps().Changed(sw::ContentChange::Nodes);
 #ifndef NDEBUG
     SwNode *const pFirst((*this)[nDelPos]);
 #endif
@@ -2426,12 +2429,14 @@ void SwNodes::RemoveNode( SwNodeOffset nDelPos, SwNodeOffset nSz, bool bDel )
 
 void SwNodes::InsertNode( SwNode* pNode, const SwNodeIndex& rPos )
 {
+    GetDoc().GetContentChangeStamps().Changed(sw::ContentChange::Nodes);
     BigPtrEntry* pIns = pNode;
     BigPtrArray::Insert( pIns, sal_Int32(rPos.GetIndex()) );
 }
 
 void SwNodes::InsertNode( SwNode* pNode, SwNodeOffset nPos )
 {
+    GetDoc().GetContentChangeStamps().Changed(sw::ContentChange::Nodes);
     BigPtrEntry* pIns = pNode;
     BigPtrArray::Insert( pIns, sal_Int32(nPos) );
 }
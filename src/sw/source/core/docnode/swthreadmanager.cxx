@@ -75,4 +75,9 @@ bool SwThreadManager::StartingOfThreadsSuspended()
     return mpThreadManagerImpl->StartingOfThreadsSuspended();
 }
 
+SwThreadManagerStatistics SwThreadManager::GetStatistics()
+{
+    return mpThreadManagerImpl->GetStatistics();
+}
+
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
@@ -22,6 +22,7 @@
 #include <threadlistener.hxx>
 
 #include <osl/diagnose.h>
+#include <tools/time.hxx>
 
 #include <algorithm>
 
@@ -81,6 +82,7 @@ oslInterlockedCount ThreadManager::AddThread(
 
         aThreadData.pThread = rThread;
         aThreadData.aJob = new CancellableJob( aThreadData.pThread );
+        aThreadData.nAddTime = tools::Time::GetSystemTicks();
 
         aThreadData.pThread->setPriority( osl_Thread_PriorityBelowNormal );
         mpThreadListener->ListenToThread( aThreadData.nThreadID,
@@ -130,6 +132,11 @@ void ThreadManager::RemoveThread( const oslInterlockedCount nThreadID,
 
         if ( bThreadFinished )
         {
+            const sal_uInt64 nRunTime = tools::Time::GetSystemTicks() - aTmpThreadData.nStartTime;
+            ++maStatistics.nFinished;
+            maStatistics.nTotalRunTime += nRunTime;
+            maStatistics.nMaxRunTime = std::max( maStatistics.nMaxRunTime, nRunTime );
+
             // release thread as job from thread joiner instance
             css::uno::Reference< css::util::XJobManager > rThreadJoiner( mrThreadJoiner );
             if ( rThreadJoiner.is() )
@@ -163,8 +170,8 @@ bool ThreadManager::StartWaitingThread()
 {
     if ( !maWaitingForStartThreads.empty() )
     {
-        tThreadData aThreadData( maWaitingForStartThreads.front() );
-        maWaitingForStartThreads.pop_front();
+        tThreadData aThreadData( maWaitingForStartThreads.back() );
+        maWaitingForStartThreads.pop_back();
         return StartThread( aThreadData );
     }
     else
@@ -183,6 +190,10 @@ bool ThreadManager::StartThread( const tThreadData& rThreadData )
         bThreadStarted = true;
 
         maStartedThreads.push_back( rThreadData );
+        maStartedThreads.back().nStartTime = tools::Time::GetSystemTicks();
+        const sal_uInt64 nWaitTime = maStartedThreads.back().nStartTime - rThreadData.nAddTime;
+        maStatistics.nTotalWaitTime += nWaitTime;
+        maStatistics.nMaxWaitTime = std::max( maStatistics.nMaxWaitTime, nWaitTime );
 
         // register thread as job at thread joiner instance
         css::uno::Reference< css::util::XJobManager > rThreadJoiner( mrThreadJoiner );
@@ -198,7 +209,7 @@ bool ThreadManager::StartThread( const tThreadData& rThreadData )
     else
     {
         // thread couldn't be started.
-        maWaitingForStartThreads.push_front( rThreadData );
+        maWaitingForStartThreads.push_back( rThreadData );
     }
 
     return bThreadStarted;
@@ -224,6 +235,16 @@ IMPL_LINK_NOARG(ThreadManager, TryToStartNewThread, Timer *, void)
     }
 }
 
+SwThreadManagerStatistics ThreadManager::GetStatistics()
+{
+    std::unique_lock aGuard(maMutex);
+
+    SwThreadManagerStatistics aStatistics( maStatistics );
+    aStatistics.nWaiting = maWaitingForStartThreads.size();
+    aStatistics.nRunning = maStartedThreads.size();
+    return aStatistics;
+}
+
 void ThreadManager::ResumeStartingOfThreads()
 {
     std::unique_lock aGuard(maMutex);
@@ -27,6 +27,7 @@
 #include <deque>
 #include <cppuhelper/weakref.hxx>
 #include <observablethread.hxx>
+#include <swthreadmanager.hxx>
 
 #include <memory>
 
@@ -42,7 +43,8 @@ class Timer;
     OD 2007-01-29 #i73788#
     An instance of this class takes care of the starting of threads.
     It assures that not more than <mnStartedSize> threads
-    are started.
+    are started. Waiting threads are started newest first: the most recent
+    requests are the ones for the content currently shown.
 */
 class ThreadManager final
 {
@@ -95,15 +97,21 @@ class ThreadManager final
             return mbStartingOfThreadsSuspended;
         }
 
+        SwThreadManagerStatistics GetStatistics();
+
         struct tThreadData
         {
             oslInterlockedCount nThreadID;
             ::rtl::Reference< ObservableThread > pThread;
             css::uno::Reference< css::util::XCancellable > aJob;
+            sal_uInt64 nAddTime;
+            sal_uInt64 nStartTime;
 
             tThreadData()
                 : nThreadID( 0 ),
-                  aJob()
+                  aJob(),
+                  nAddTime( 0 ),
+                  nStartTime( 0 )
             {}
         };
 
@@ -126,6 +134,9 @@ class ThreadManager final
 
         bool mbStartingOfThreadsSuspended;
 
+        /// counters of the started and finished threads, see <GetStatistics()>
+        SwThreadManagerStatistics maStatistics;
+
         struct ThreadPred
         {
             oslInterlockedCount mnThreadID;
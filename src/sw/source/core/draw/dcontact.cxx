@@ -988,6 +988,8 @@ void SwDrawContact::Changed( const SdrObject& rObj,
         return;
     }
 
+    pDoc->GetContentChangeStamps().Changed(sw::ContentChange::DrawObjects);
+
     //Put on Action, but not if presently anywhere an action runs.
     bool bHasActions(true);
     SwRootFrame *pTmpRoot = pDoc->getIDocumentLayoutAccess().GetCurrentLayout();
@@ -38,6 +38,7 @@
 #include <doc.hxx>
 #include <IDocumentLinksAdministration.hxx>
 #include <IDocumentLayoutAccess.hxx>
+#include <DocumentTimerManager.hxx>
 #include <frmatr.hxx>
 #include <grfatr.hxx>
 #include <swtypes.hxx>
@@ -71,7 +72,7 @@ SwGrfNode::SwGrfNode(
     mbIsStreamReadOnly( false )
 {
     mbInSwapIn = mbChangeTwipSize =
-        mbFrameInPaint = mbScaleImageMap = false;
+        mbFrameInPaint = mbScaleImageMap = mbGraphicPainted = false;
 
     ReRead(rGrfName, rFltName, pGraphic, false);
 }
@@ -97,7 +98,7 @@ SwGrfNode::SwGrfNode( SwNode& rWhere,
     maGrfObj.SetGraphic( aGrf );
 
     mbInSwapIn = mbChangeTwipSize =
-        mbFrameInPaint = mbScaleImageMap = false;
+        mbFrameInPaint = mbScaleImageMap = mbGraphicPainted = false;
 
     InsertLink( rGrfName, rFltName );
     if( IsLinkedFile() )
@@ -266,6 +267,7 @@ SwGrfNode::~SwGrfNode()
     mpThreadConsumer.reset();
 
     SwDoc& rDoc = GetDoc();
+    rDoc.GetDocumentTimerManager().CancelGraphicSwapIn(*this);
     if( mxLink.is() )
     {
         OSL_ENSURE( !mbInSwapIn, "DTOR: I am still in SwapIn" );
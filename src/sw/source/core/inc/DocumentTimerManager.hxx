@@ -26,7 +26,11 @@
 #include <sal/types.h>
 #include <tools/link.hxx>
 
+#include <unordered_set>
+#include <vector>
+
 class SwDoc;
+class SwGrfNode;
 
 namespace sw
 {
@@ -37,6 +41,7 @@ public:
     {
         None, ///< document has no idle jobs to do
         Busy, ///< document is busy and idle jobs are postponed
+        Graphics,
         Grammar,
         Layout,
         Fields,
@@ -55,6 +60,16 @@ public:
 
     bool IsDocIdle() const override;
 
+    /// Loads an embedded graphic, which was painted before it was loaded, when idle.
+    /// The queued graphics are decoded in batches, each blocking until it is done.
+    void QueueGraphicSwapIn(SwGrfNode& rNode);
+    void CancelGraphicSwapIn(const SwGrfNode& rNode);
+    /// The graphic of rNode could not be loaded when idle, don't queue it again.
+    bool IsGraphicSwapInFailed(const SwGrfNode& rNode) const
+    {
+        return m_aFailedGraphicSwapIns.count(&rNode) != 0;
+    }
+
 private:
     DocumentTimerManager(DocumentTimerManager const&) = delete;
     DocumentTimerManager& operator=(DocumentTimerManager const&) = delete;
@@ -67,6 +82,8 @@ private:
 
     IdleJob GetNextIdleJob() const;
 
+    void SwapInGraphics();
+
     SwDoc& m_rDoc;
 
     sal_uInt32 m_nIdleBlockCount; ///< Don't run the Idle, if > 0
@@ -74,6 +91,9 @@ private:
     SwDocIdle m_aDocIdle;
     Timer m_aFireIdleJobsTimer;
     bool m_bWaitForLokInit; ///< true if we waited for LOK to initialize already.
+    /// graphics to load, in the order they were painted (so the visible ones come first)
+    std::vector<SwGrfNode*> m_aGraphicSwapIns;
+    std::unordered_set<const SwGrfNode*> m_aFailedGraphicSwapIns;
 };
 
 inline bool DocumentTimerManager::IsDocIdle() const
@@ -30,6 +30,7 @@ class SfxViewShell;
 
 namespace sw::mark {
     typedef std::unordered_map<OUString, sal_Int32> MarkBasenameMapUniqueOffset_t;
+    typedef std::unordered_multimap<OUString, sw::mark::MarkBase*> MarkNameIndex_t;
 
     class FieldmarkWithDropDownButton;
 
@@ -123,6 +124,9 @@ namespace sw::mark {
 
             virtual void assureSortedMarkContainers() const override;
 
+            virtual void startBulkInsert() override;
+            virtual void endBulkInsert() override;
+
             typedef std::vector<sw::mark::MarkBase*> container_t;
 
             // helper bookmark to store annotation range of redlines
@@ -144,6 +148,14 @@ namespace sw::mark {
             void sortSubsetMarks();
             void sortMarks();
 
+            // merge the marks created during bulk insertion into the containers
+            void insertPendingMarks();
+            void assureNoPendingMarks() const
+            {
+                if (!m_vPendingMarks.empty())
+                    const_cast<MarkManager*>(this)->insertPendingMarks();
+            }
+
             // container for all marks, this container owns the objects it points to
             container_t m_vAllMarks;
 
@@ -154,6 +166,14 @@ namespace sw::mark {
 
             mutable MarkBasenameMapUniqueOffset_t m_aMarkBasenameMapUniqueOffset;
 
+            // names of the marks in m_vAllMarks and m_vPendingMarks
+            MarkNameIndex_t m_aMarkNameIndex;
+
+            // marks created by makeMark() during bulk insertion, in creation
+            // order; not yet part of the sorted containers
+            container_t m_vPendingMarks;
+            sal_uInt32 m_nBulkInsertLevel;
+
             // container for annotation marks
             container_t m_vAnnotationMarks;
 
@@ -15,8 +15,16 @@
 #include <basegfx/range/b2drange.hxx>
 #include <utility>
 
+class SvStream;
+
 namespace sw::search
 {
+/// Binary term index written by sw::IndexingExport::runTermIndexExport(): "SWTI" in little endian
+constexpr sal_uInt32 constTermIndexMagic = 0x49545753;
+constexpr sal_uInt16 constTermIndexVersion = 1;
+/// node type (1 byte), index (4 bytes), object name (4 bytes)
+constexpr sal_uInt64 constTermPostingSize = 9;
+
 enum class NodeType
 {
     Undefined = 0,
@@ -64,6 +72,11 @@ public:
 
     LocationResult find(std::vector<SearchIndexData> const& rSearchIndexDataVector);
     LocationResult findForPayload(const char* pPayload);
+    LocationResult findForTerm(SvStream& rIndexStream, const OUString& rTerm);
+
+    /// Reads the paragraphs containing rTerm from a binary term index, without loading the document.
+    static bool lookupTerm(SvStream& rIndexStream, const OUString& rTerm,
+                           std::vector<SearchIndexData>& rDataVector);
 };
 
 } // end sw namespace
@@ -80,11 +80,18 @@ struct SwSortElement
     virtual OUString GetKey(sal_uInt16 nKey ) const = 0;
     virtual double GetValue(sal_uInt16 nKey ) const;
 
+    /// Extract the keys once, comparisons only use the cached keys
+    void CacheKeys();
+
     bool operator<(const SwSortElement& ) const;
 
     static double StrToDouble(std::u16string_view rStr);
 private:
     int keycompare(const SwSortElement& rCmp, sal_uInt16 nKey) const;
+
+    // per sort key: the text of alphanumeric keys, the value of numeric keys
+    std::vector<OUString> aKeyTexts;
+    std::vector<double> aKeyValues;
 };
 
 // sort text
@@ -131,6 +131,11 @@ void PaintCharacterBorder(const SwFont& rFont, const SwRect& rPaintArea, const b
                           const bool bVerticalLayoutLRBT, const bool bJoinWithPrev,
                           const bool bJoinWithNext);
 
+// Drops the merged border lines cached for painting table frames; called for
+// every change of frame geometry or of cell/row/table attributes.
+// Implementation in paintfrm.cxx
+void InvalidateTabFrameBorderLines();
+
 // get Fly, if no List is given use the current shell
 // Implementation in feshview.cxx
 SwFlyFrame *GetFlyFromMarked( const SdrMarkList *pLst, SwViewShell *pSh );
@@ -35,6 +35,7 @@ class SwTextFrame;
 class Point;
 class MultiSelection;
 enum class SwFontScript;
+enum class CharCompressType;
 namespace sw { struct MergedPara; }
 namespace sw::mark { class IBookmark; }
 
@@ -89,6 +90,12 @@ private:
     TextFrameIndex m_nInvalidityPos;
     sal_uInt8 m_nDefaultDir;
 
+    /// text of the last InitScriptInfo(), to find the unchanged end of the text after edits
+    OUString m_aText;
+    CharCompressType m_eCompressionType;
+    /// m_ScriptChanges before the changes for RTL runs were applied; empty if there were none
+    std::vector<ScriptChangeInfo> m_RawScriptChanges;
+
     void UpdateBidiInfo( const OUString& rText );
     bool IsKashidaValid(size_t nKashPos) const;
     // returns true if nKashPos is newly marked invalid
@@ -113,6 +113,9 @@ public:
 
     void IncreaseMax( const sal_uInt16 nAdd );
     void DecreaseMax( const sal_uInt16 nSub );
+    /// Delete unlocked objects from the end of the LRU list until there are
+    /// no more than GetCurMax() left, e.g. after DecreaseMax()
+    void ShrinkToMax();
     sal_uInt16 GetCurMax() const { return m_nCurMax; }
     SwCacheObj *First() { return m_pRealFirst; }
     static inline SwCacheObj *Next( SwCacheObj *pCacheObj);
@@ -20,6 +20,7 @@
 #define INCLUDED_SW_SOURCE_CORE_INC_SWTHREADMANAGER_HXX
 
 #include <osl/interlck.h>
+#include <sal/types.h>
 
 #include <memory>
 
@@ -28,6 +29,18 @@ namespace rtl { template <class reference_type> class Reference; }
 class ObservableThread;
 class ThreadManager;
 
+/// Counters of the <ThreadManager>, times are in milliseconds.
+struct SwThreadManagerStatistics
+{
+    sal_uInt32 nWaiting = 0; ///< threads waiting to be started
+    sal_uInt32 nRunning = 0;
+    sal_uInt32 nFinished = 0;
+    sal_uInt64 nTotalWaitTime = 0; ///< from adding to starting, of all started threads
+    sal_uInt64 nMaxWaitTime = 0;
+    sal_uInt64 nTotalRunTime = 0; ///< from starting to finishing, of all finished threads
+    sal_uInt64 nMaxRunTime = 0;
+};
+
 /** class to manage threads in Writer using a <ThreadManager> instance
 
     #i73788#
@@ -63,6 +76,8 @@ class SwThreadManager
 
         bool StartingOfThreadsSuspended();
 
+        SwThreadManagerStatistics GetStatistics();
+
     private:
 
         SwThreadManager(SwThreadManager const&) = delete;
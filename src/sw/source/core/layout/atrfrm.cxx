@@ -2634,12 +2634,14 @@ SwFrameFormat::SwFrameFormat(
 :   SwFormat(rPool, rFormatNm, pWhichRange, pDrvdFrame, nFormatWhich),
     m_ffList(nullptr)
 {
+    GetDoc()->GetContentChangeStamps().Changed(sw::ContentChange::Formats);
 }
 
 SwFrameFormat::~SwFrameFormat()
 {
     if( !GetDoc()->IsInDtor())
     {
+        GetDoc()->GetContentChangeStamps().Changed(sw::ContentChange::Formats);
         const SwFormatAnchor& rAnchor = GetAnchor();
         if (SwNode* pAnchorNode = rAnchor.GetAnchorNode())
         {
@@ -2669,6 +2671,7 @@ SwFrameFormat::~SwFrameFormat()
 
 void SwFrameFormat::SetFormatName( const OUString& rNewName, bool bBroadcast )
 {
+    GetDoc()->GetContentChangeStamps().Changed(sw::ContentChange::Formats);
     if (m_ffList != nullptr) {
         SAL_INFO_IF(m_aFormatName == rNewName, "sw.core", "SwFrmFmt not really renamed, as both names are equal");
         sw::NameChanged aHint(m_aFormatName, rNewName);
@@ -2712,6 +2715,7 @@ void SwFrameFormat::SwClientNotify(const SwModify& rMod, const SfxHint& rHint)
 {
     if (rHint.GetId() != SfxHintId::SwLegacyModify)
         return;
+    GetDoc()->GetContentChangeStamps().Changed(sw::ContentChange::Formats);
     auto pLegacy = static_cast<const sw::LegacyModifyHint*>(&rHint);
     const sal_uInt16 nNewWhich = pLegacy->m_pNew ? pLegacy->m_pNew->Which() : 0;
     const SwAttrSetChg* pNewAttrSetChg = nullptr;
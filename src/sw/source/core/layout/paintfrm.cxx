@@ -18,6 +18,7 @@
  */
 
 #include <utility>
+#include <o3tl/lru_map.hxx>
 #include <vcl/canvastools.hxx>
 #include <vcl/lazydelete.hxx>
 #include <sfx2/docfile.hxx>
@@ -2387,10 +2388,63 @@ typedef std::map< SwTwips, SwLineEntrySet > SwLineEntryMap;
 
 namespace {
 
+/// The merged border lines of a table frame, sorted by key and start position.
+struct SwTabFrameLines
+{
+    std::vector<SwLineEntry> maHoriLines;
+    std::vector<SwLineEntry> maVertLines;
+    sal_uInt32 mnStamp = 0;
+    bool mbWordTableCell = false;
+};
+
+/// Number of table frames whose border lines are kept.
+constexpr size_t TAB_FRAME_LINES_CACHE_SIZE = 64;
+
+}
+
+/// Incremented by InvalidateTabFrameBorderLines(), cached lines with an older
+/// stamp are outdated.
+static sal_uInt32 gnTabFrameLinesStamp = 0;
+
+void InvalidateTabFrameBorderLines()
+{
+    ++gnTabFrameLinesStamp;
+}
+
+/// Maps the frame id of a table frame to its border lines.
+static o3tl::lru_map<sal_uInt32, std::shared_ptr<const SwTabFrameLines>>& lcl_GetTabFrameLinesCache()
+{
+    static o3tl::lru_map<sal_uInt32, std::shared_ptr<const SwTabFrameLines>> aCache(
+        TAB_FRAME_LINES_CACHE_SIZE);
+    return aCache;
+}
+
+static void lcl_FlattenLines(const SwLineEntryMap& rMap, std::vector<SwLineEntry>& rLines)
+{
+    for (const auto& rEntry : rMap)
+        rLines.insert(rLines.end(), rEntry.second.begin(), rEntry.second.end());
+}
+
+/// Returns the lines of rLines with the key nKey.
+static std::pair<std::vector<SwLineEntry>::const_iterator, std::vector<SwLineEntry>::const_iterator>
+lcl_FindLines(const std::vector<SwLineEntry>& rLines, SwTwips nKey)
+{
+    struct LessKey
+    {
+        bool operator()(const SwLineEntry& rEntry, SwTwips nValue) const { return rEntry.mnKey < nValue; }
+        bool operator()(SwTwips nValue, const SwLineEntry& rEntry) const { return nValue < rEntry.mnKey; }
+    };
+    return std::equal_range(rLines.begin(), rLines.end(), nKey, LessKey());
+}
+
+namespace {
+
 class SwTabFramePainter
 {
+    // only used while merging the lines, see mpLines for the result
     SwLineEntryMap maVertLines;
     SwLineEntryMap maHoriLines;
+    std::shared_ptr<const SwTabFrameLines> mpLines;
     const SwTabFrame& mrTabFrame;
 
     void Insert( SwLineEntry&, bool bHori );
@@ -2422,8 +2476,39 @@ public:
 SwTabFramePainter::SwTabFramePainter( const SwTabFrame& rTabFrame )
     : mrTabFrame( rTabFrame )
 {
+    bool bWordTableCell = false;
+    SwViewShell* pShell = rTabFrame.getRootFrame()->GetCurrShell();
+    if (pShell)
+    {
+        const IDocumentSettingAccess& rIDSA = pShell->GetDoc()->getIDocumentSettingAccess();
+        bWordTableCell = rIDSA.get(DocumentSettingId::TABLE_ROW_KEEP);
+    }
+
+    // The merged lines only depend on the geometry of the frames and on the
+    // cell borders; reuse them as long as neither changed.
+    auto& rCache = lcl_GetTabFrameLinesCache();
+    auto aCached = rCache.find(rTabFrame.GetFrameId());
+    if (aCached != rCache.end() && aCached->second->mnStamp == gnTabFrameLinesStamp
+        && aCached->second->mbWordTableCell == bWordTableCell)
+    {
+        mpLines = aCached->second;
+        return;
+    }
+
+    auto pLines = std::make_shared<SwTabFrameLines>();
+    pLines->mnStamp = gnTabFrameLinesStamp;
+    pLines->mbWordTableCell = bWordTableCell;
+
     SwRect aPaintArea = rTabFrame.GetUpper()->GetPaintArea();
     HandleFrame(rTabFrame, aPaintArea);
+
+    lcl_FlattenLines(maHoriLines, pLines->maHoriLines);
+    lcl_FlattenLines(maVertLines, pLines->maVertLines);
+    maHoriLines.clear();
+    maVertLines.clear();
+
+    mpLines = pLines;
+    rCache.insert(std::make_pair(rTabFrame.GetFrameId(), std::move(pLines)));
 }
 
 void SwTabFramePainter::HandleFrame(const SwLayoutFrame& rLayoutFrame, const SwRect& rPaintArea)
@@ -2462,9 +2547,6 @@ void SwTabFramePainter::PaintLines(OutputDevice& rDev, const SwRect& rRect) cons
     // #i16816# tagged pdf support
     SwTaggedPDFHelper aTaggedPDFHelper( nullptr, nullptr, nullptr, rDev );
 
-    SwLineEntryMap::const_iterator aIter = maHoriLines.begin();
-    bool bHori = true;
-
     // color for subsidiary lines:
     const Color& rCol( gProp.pSGlobalShell->GetViewOptions()->GetTableBoundariesColor() );
 
@@ -2488,19 +2570,10 @@ void SwTabFramePainter::PaintLines(OutputDevice& rDev, const SwRect& rRect) cons
     // prepare SdrFrameBorderDataVector
     drawinglayer::primitive2d::SdrFrameBorderDataVector aData;
 
-    while ( true )
+    for (const bool bHori : { true, false })
     {
-        if ( bHori && aIter == maHoriLines.end() )
-        {
-            aIter = maVertLines.begin();
-            bHori = false;
-        }
-
-        if ( !bHori && aIter == maVertLines.end() )
-            break;
-
-        const SwLineEntrySet& rEntrySet = (*aIter).second;
-        for (const SwLineEntry& rEntry : rEntrySet)
+        const std::vector<SwLineEntry>& rLines = bHori ? mpLines->maHoriLines : mpLines->maVertLines;
+        for (const SwLineEntry& rEntry : rLines)
         {
             const svx::frame::Style& rEntryStyle( rEntry.maAttribute );
 
@@ -2670,7 +2743,6 @@ void SwTabFramePainter::PaintLines(OutputDevice& rDev, const SwRect& rRect) cons
                 }
             }
         }
-        ++aIter;
     }
 
     // create instance of SdrFrameBorderPrimitive2D if
@@ -2717,12 +2789,12 @@ void SwTabFramePainter::FindStylesForLine( Point& rStartPoint,
         bWordTableCell = rIDSA.get(DocumentSettingId::TABLE_ROW_KEEP);
     }
 
-    SwLineEntryMap::const_iterator aMapIter = maVertLines.find( rStartPoint.X() );
-    assert(aMapIter != maVertLines.end() && "FindStylesForLine: Error");
-    const SwLineEntrySet& rVertSet = (*aMapIter).second;
+    auto aRange = lcl_FindLines(mpLines->maVertLines, rStartPoint.X());
+    assert(aRange.first != aRange.second && "FindStylesForLine: Error");
 
-    for ( const SwLineEntry& rEntry : rVertSet )
+    for (auto aIter = aRange.first; aIter != aRange.second; ++aIter)
     {
+        const SwLineEntry& rEntry = *aIter;
         if ( bHori )
         {
             if ( rStartPoint.Y() == rEntry.mnStartPos )
@@ -2744,12 +2816,12 @@ void SwTabFramePainter::FindStylesForLine( Point& rStartPoint,
         }
     }
 
-    aMapIter = maHoriLines.find( rStartPoint.Y() );
-    assert(aMapIter != maHoriLines.end() && "FindStylesForLine: Error");
-    const SwLineEntrySet& rHoriSet = aMapIter->second;
+    aRange = lcl_FindLines(mpLines->maHoriLines, rStartPoint.Y());
+    assert(aRange.first != aRange.second && "FindStylesForLine: Error");
 
-    for ( const SwLineEntry& rEntry : rHoriSet )
+    for (auto aIter = aRange.first; aIter != aRange.second; ++aIter)
     {
+        const SwLineEntry& rEntry = *aIter;
         if ( bHori )
         {
             if ( rStartPoint.X() == rEntry.mnEndPos )
@@ -2773,12 +2845,12 @@ void SwTabFramePainter::FindStylesForLine( Point& rStartPoint,
 
     if ( bHori )
     {
-        aMapIter = maVertLines.find( rEndPoint.X() );
-        assert(aMapIter != maVertLines.end() && "FindStylesForLine: Error");
-        const SwLineEntrySet& rVertSet2 = (*aMapIter).second;
+        aRange = lcl_FindLines(mpLines->maVertLines, rEndPoint.X());
+        assert(aRange.first != aRange.second && "FindStylesForLine: Error");
 
-        for ( const SwLineEntry& rEntry : rVertSet2 )
+        for (auto aIter = aRange.first; aIter != aRange.second; ++aIter)
         {
+            const SwLineEntry& rEntry = *aIter;
             if ( rEndPoint.Y() == rEntry.mnStartPos )
                 pStyles[ 6 ] = rEntry.maAttribute;
             else if ( rEndPoint.Y() == rEntry.mnEndPos )
@@ -2792,12 +2864,12 @@ void SwTabFramePainter::FindStylesForLine( Point& rStartPoint,
     }
     else
     {
-        aMapIter = maHoriLines.find( rEndPoint.Y() );
-        assert(aMapIter != maHoriLines.end() && "FindStylesForLine: Error");
-        const SwLineEntrySet& rHoriSet2 = (*aMapIter).second;
+        aRange = lcl_FindLines(mpLines->maHoriLines, rEndPoint.Y());
+        assert(aRange.first != aRange.second && "FindStylesForLine: Error");
 
-        for ( const SwLineEntry& rEntry : rHoriSet2 )
+        for (auto aIter = aRange.first; aIter != aRange.second; ++aIter)
         {
+            const SwLineEntry& rEntry = *aIter;
             if ( rEndPoint.X() == rEntry.mnEndPos )
                 pStyles[ 4 ] = rEntry.maAttribute;
             else if ( rEndPoint.X() == rEntry.mnStartPos )
@@ -423,6 +423,7 @@ SwContentFrame::SwContentFrame( SwContentNode * const pContent, SwFrame* pSib )
     SwFlowFrame( static_cast<SwFrame&>(*this) )
 {
     assert(!getRootFrame()->HasMergedParas() || pContent->IsCreateFrameWhenHidingRedlines());
+    pContent->GetDoc().GetContentChangeStamps().Changed(sw::ContentChange::Layout);
 }
 
 void SwContentFrame::DestroyImpl()
@@ -436,8 +437,12 @@ void SwContentFrame::DestroyImpl()
     assert(nullptr == pCNd || !pCNd->GetDoc().IsInDtor());
     if (nullptr != pCNd && !pCNd->GetDoc().IsInDtor())
     {
-        //Unregister from root if I'm still in turbo there.
         SwRootFrame *pRoot = getRootFrame();
+        if (pRoot)
+            pRoot->GetFormat()->GetDoc()->GetContentChangeStamps().Changed(
+                sw::ContentChange::Layout);
+
+        //Unregister from root if I'm still in turbo there.
         if( pRoot && pRoot->GetTurbo() == this )
         {
             pRoot->DisallowTurbo();
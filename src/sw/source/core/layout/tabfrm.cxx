@@ -189,7 +189,8 @@ static bool lcl_ArrangeLowers( SwLayoutFrame *pLay, tools::Long lYStart, bool bI
 // that only row and cell frames are formatted.
 static bool lcl_InnerCalcLayout( SwFrame *pFrame,
                                       tools::Long nBottom,
-                                      bool _bOnlyRowsAndCells = false );
+                                      bool _bOnlyRowsAndCells = false,
+                                      bool bOnlyThisFrame = false );
 // OD 2004-02-18 #106629# - correct type of 1st parameter
 // #i26945# - add parameter <_bConsiderObjs> in order to
 // control, if floating screen objects have to be considered for the minimal
@@ -1069,6 +1070,20 @@ static bool lcl_FindSectionsInRow( const SwRowFrame& rRow )
     return bRet;
 }
 
+/// Does the row contain cells, which are covered by a cell spanning from a previous row?
+static bool lcl_HasCoveredCells( const SwFrame& rRow )
+{
+    if ( !rRow.IsRowFrame() )
+        return false;
+    for ( const SwFrame* pCell = static_cast<const SwRowFrame&>(rRow).Lower(); pCell; pCell = pCell->GetNext() )
+    {
+        const SwTableBox* pBox = pCell->IsCellFrame() ? static_cast<const SwCellFrame*>(pCell)->GetTabBox() : nullptr;
+        if ( pBox && pBox->getRowSpan() < 1 )
+            return true;
+    }
+    return false;
+}
+
 bool SwTabFrame::Split(const SwTwips nCutPos, bool bTryToSplit,
         bool bTableRowKeep, bool & rIsFootnoteGrowth)
 {
@@ -1081,7 +1096,27 @@ bool SwTabFrame::Split(const SwTwips nCutPos, bool bTryToSplit,
         Lower()->InvalidatePos_();
         // #i43913# - correction
         // call method <lcl_InnerCalcLayout> with first lower.
-        lcl_InnerCalcLayout( Lower(), LONG_MAX, true );
+        // Only the rows up to the one crossing the cut position, the one after
+        // it (it may be kept in this table) and the rows continuing a row span
+        // are needed to find the split position. The others are moved to the
+        // follow table and formatted there; formatting all of them here would
+        // make the layout of a table spanning many pages quadratic.
+        SwFrame* pCalcRow = Lower();
+        bool bBelowCutPos = false;
+        bool bNextRowDone = false;
+        while ( pCalcRow && pCalcRow->GetUpper() == this )
+        {
+            if ( bBelowCutPos )
+            {
+                if ( bNextRowDone && !lcl_HasCoveredCells( *pCalcRow ) )
+                    break;
+                bNextRowDone = true;
+            }
+            lcl_InnerCalcLayout( pCalcRow, LONG_MAX, true, true );
+            if ( aRectFnSet.YDiff( aRectFnSet.GetBottom( pCalcRow->getFrameArea() ), nCutPos ) > 0 )
+                bBelowCutPos = true;
+            pCalcRow = pCalcRow->GetNext();
+        }
     }
 
     //In order to be able to compare the positions of the cells with CutPos,
@@ -1809,7 +1844,8 @@ bool SwContentFrame::CalcLowers(SwLayoutFrame & rLay, SwLayoutFrame const& rDont
 // that only row and cell frames are formatted.
 static bool lcl_InnerCalcLayout( SwFrame *pFrame,
                                       tools::Long nBottom,
-                                      bool _bOnlyRowsAndCells )
+                                      bool _bOnlyRowsAndCells,
+                                      bool bOnlyThisFrame )
 {
     vcl::RenderContext* pRenderContext = pFrame->getRootFrame()->GetCurrShell() ? pFrame->getRootFrame()->GetCurrShell()->GetOut() : nullptr;
     // LONG_MAX == nBottom means we have to calculate all
@@ -1848,6 +1884,8 @@ static bool lcl_InnerCalcLayout( SwFrame *pFrame,
                 }
             }
         }
+        if ( bOnlyThisFrame )
+            break;
         pFrame = pFrame->GetNext();
     } while( pFrame &&
             ( bAll ||
@@ -4503,6 +4541,7 @@ void SwRowFrame::SwClientNotify(const SwModify& rModify, const SfxHint& rHint)
         if(GetTabLine() != &pNewFormatHint->m_rTabLine)
             return;
         RegisterToFormat(const_cast<SwTableLineFormat&>(pNewFormatHint->m_rNewFormat));
+        InvalidateTabFrameBorderLines();
         InvalidateSize();
         InvalidatePrt_();
         SetCompletePaint();
@@ -6088,6 +6127,7 @@ void SwCellFrame::SwClientNotify(const SwModify& rMod, const SfxHint& rHint)
         if(GetTabBox() != &pNewFormatHint->m_rTableBox)
             return;
         RegisterToFormat(const_cast<SwTableBoxFormat&>(pNewFormatHint->m_rNewFormat));
+        InvalidateTabFrameBorderLines();
         InvalidateSize();
         InvalidatePrt_();
         SetCompletePaint();
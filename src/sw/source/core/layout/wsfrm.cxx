@@ -112,6 +112,7 @@ SwFrameAreaDefinition::FrameAreaWriteAccess::~FrameAreaWriteAccess()
     if(mrTarget.maFrameArea != *this)
     {
         mrTarget.maFrameArea = *this;
+        InvalidateTabFrameBorderLines();
     }
 }
 
@@ -120,6 +121,7 @@ SwFrameAreaDefinition::FramePrintAreaWriteAccess::~FramePrintAreaWriteAccess()
     if(mrTarget.maFramePrintArea != *this)
     {
         mrTarget.maFramePrintArea = *this;
+        InvalidateTabFrameBorderLines();
     }
 }
 
@@ -16,9 +16,11 @@
 #include <viewsh.hxx>
 #include <IDocumentDrawModelAccess.hxx>
 #include <IDocumentLayoutAccess.hxx>
+#include <swtypes.hxx>
 
 #include <tools/XmlWalker.hxx>
 #include <tools/stream.hxx>
+#include <unotools/charclass.hxx>
 
 #include <boost/property_tree/json_parser.hpp>
 
@@ -195,6 +197,72 @@ LocationResult SearchResultLocator::findForPayload(const char* pPayload)
     return find(aDataVector);
 }
 
+/** Looks up a term in a binary term index
+ *
+ *  Returns true if the stream was identified as a term index, else false
+ */
+bool SearchResultLocator::lookupTerm(SvStream& rIndexStream, const OUString& rTerm,
+                                     std::vector<sw::search::SearchIndexData>& rDataVector)
+{
+    sal_uInt32 nMagic = 0;
+    sal_uInt16 nVersion = 0;
+    rIndexStream.ReadUInt32(nMagic).ReadUInt16(nVersion);
+    if (!rIndexStream.good() || nMagic != constTermIndexMagic || nVersion != constTermIndexVersion)
+        return false;
+
+    sal_uInt32 nObjectNames = 0;
+    rIndexStream.ReadUInt32(nObjectNames);
+    std::vector<OUString> aObjectNames;
+    for (sal_uInt32 i = 0; i < nObjectNames && rIndexStream.good(); ++i)
+        aObjectNames.push_back(
+            read_uInt16_lenPrefixed_uInt8s_ToOUString(rIndexStream, RTL_TEXTENCODING_UTF8));
+
+    // terms are stored lowercased and sorted
+    const OUString aTerm = GetAppCharClass().lowercase(rTerm);
+    sal_uInt32 nTerms = 0;
+    rIndexStream.ReadUInt32(nTerms);
+    for (sal_uInt32 nTerm = 0; nTerm < nTerms && rIndexStream.good(); ++nTerm)
+    {
+        const OUString aEntry
+            = read_uInt16_lenPrefixed_uInt8s_ToOUString(rIndexStream, RTL_TEXTENCODING_UTF8);
+        sal_uInt32 nPostings = 0;
+        rIndexStream.ReadUInt32(nPostings);
+        if (aTerm < aEntry)
+            break;
+        if (aEntry != aTerm)
+        {
+            rIndexStream.SeekRel(nPostings * constTermPostingSize);
+            continue;
+        }
+
+        for (sal_uInt32 i = 0; i < nPostings && rIndexStream.good(); ++i)
+        {
+            sal_uInt8 nType = 0;
+            sal_Int32 nIndex = -1;
+            sal_uInt32 nObjectName = 0;
+            rIndexStream.ReadUChar(nType).ReadInt32(nIndex).ReadUInt32(nObjectName);
+
+            auto eNodeType = NodeType(nType);
+            if ((eNodeType == NodeType::WriterNode || eNodeType == NodeType::CommonNode)
+                && nIndex >= 0 && nObjectName <= aObjectNames.size())
+            {
+                rDataVector.emplace_back(eNodeType, SwNodeOffset(nIndex),
+                                         nObjectName ? aObjectNames[nObjectName - 1] : OUString());
+            }
+        }
+        break;
+    }
+
+    return true;
+}
+
+LocationResult SearchResultLocator::findForTerm(SvStream& rIndexStream, const OUString& rTerm)
+{
+    std::vector<sw::search::SearchIndexData> aDataVector;
+    lookupTerm(rIndexStream, rTerm, aDataVector);
+    return find(aDataVector);
+}
+
 } // end sw namespace
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
@@ -1507,10 +1507,27 @@ bool SwTextFrame::FormatLine( SwTextFormatter &rLine, const bool bPrev )
     const TextFrameIndex nEnd = pPara->GetReformat().Start() +
                         pPara->GetReformat().Len();
 
-    if( nNewStart <= nEnd )
+    if( nNewStart < nEnd )
         return true;
 
-    return 0 != pPara->GetDelta();
+    // The following lines keep their old layout if they start at the same
+    // (shifted) position as before, i.e. the lengths of the reformatted lines
+    // add up to the change of the text length.
+    if( 0 != pPara->GetDelta() )
+        return true;
+
+    // If this line ends exactly at the end of the changed text, the next one
+    // starts with unchanged text, too; unless the break is inside a word, where
+    // shaping and hyphenation of the next line depend on the changed text.
+    if( nNewStart == nEnd )
+    {
+        if( !nNewStart )
+            return true;
+        const sal_Unicode cLast = GetText()[sal_Int32(nNewStart) - 1];
+        return ' ' != cLast && CH_BREAK != cLast;
+    }
+
+    return false;
 }
 
 void SwTextFrame::Format_( SwTextFormatter &rLine, SwTextFormatInfo &rInf,
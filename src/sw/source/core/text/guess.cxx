@@ -35,6 +35,9 @@
 #include <doc.hxx>
 #include <unotools/linguprops.hxx>
 
+#include <algorithm>
+#include <vector>
+
 using namespace ::com::sun::star;
 using namespace ::com::sun::star::uno;
 using namespace ::com::sun::star::i18n;
@@ -43,6 +46,65 @@ using namespace ::com::sun::star::linguistic2;
 
 namespace{
 
+/**
+ * Recent results of the break iterator for lines without hyphenation.
+ *
+ * The layout formats the same lines several times (moving frames between
+ * pages, fly underflows, widow and orphan checks), asking the break iterator
+ * for the same break position every time. The key includes the whole text,
+ * so any edit of the paragraph makes its entries unreachable.
+ */
+class LineBreakCache
+{
+    struct Entry
+    {
+        OUString maText;
+        sal_Int32 mnCutPos;
+        sal_Int32 mnLineStart;
+        lang::Locale maLocale;
+        LineBreakUserOptions maUserOpt;
+        LineBreakResults maResult;
+    };
+
+    static constexpr size_t MAX_ENTRIES = 16;
+    // most recently used first
+    std::vector<Entry> m_aEntries;
+
+public:
+    LineBreakResults getLineBreak(const OUString& rText, sal_Int32 nCutPos,
+                                  const lang::Locale& rLocale, sal_Int32 nLineStart,
+                                  const LineBreakUserOptions& rUserOpt)
+    {
+        auto it = std::find_if(m_aEntries.begin(), m_aEntries.end(),
+            [&](const Entry& rEntry)
+            {
+                return rEntry.mnCutPos == nCutPos && rEntry.mnLineStart == nLineStart
+                    && rEntry.maText == rText && rEntry.maLocale == rLocale
+                    && rEntry.maUserOpt == rUserOpt;
+            });
+        if (it != m_aEntries.end())
+        {
+            std::rotate(m_aEntries.begin(), it, it + 1);
+            return m_aEntries.front().maResult;
+        }
+
+        LineBreakResults aResult = g_pBreakIt->GetBreakIter()->getLineBreak(
+            rText, nCutPos, rLocale, nLineStart, LineBreakHyphenationOptions(), rUserOpt);
+
+        if (m_aEntries.size() == MAX_ENTRIES)
+            m_aEntries.pop_back();
+        m_aEntries.insert(m_aEntries.begin(),
+                          Entry{ rText, nCutPos, nLineStart, rLocale, rUserOpt, aResult });
+        return aResult;
+    }
+};
+
+LineBreakCache& GetLineBreakCache()
+{
+    static LineBreakCache aCache;
+    return aCache;
+}
+
 bool IsBlank(sal_Unicode ch) { return ch == CH_BLANK || ch == CH_FULL_BLANK || ch == CH_NB_SPACE || ch == CH_SIX_PER_EM; }
 
 // Used when spaces should not be counted in layout
@@ -611,9 +673,14 @@ bool SwTextGuess::Guess( const SwTextPortion& rPor, SwTextFormatInfo &rInf,
 
         // determines first possible line break from nCutPos to
         // start index of current line
-        LineBreakResults aResult = g_pBreakIt->GetBreakIter()->getLineBreak(
-            rInf.GetText(), sal_Int32(m_nCutPos), aLocale,
-            sal_Int32(rInf.GetLineStart()), aHyphOpt, aUserOpt );
+        // the result of the hyphenator can change (e.g. dictionaries), don't cache it
+        LineBreakResults aResult = xHyph.is()
+            ? g_pBreakIt->GetBreakIter()->getLineBreak(
+                rInf.GetText(), sal_Int32(m_nCutPos), aLocale,
+                sal_Int32(rInf.GetLineStart()), aHyphOpt, aUserOpt )
+            : GetLineBreakCache().getLineBreak(
+                rInf.GetText(), sal_Int32(m_nCutPos), aLocale,
+                sal_Int32(rInf.GetLineStart()), aUserOpt );
 
         m_nBreakPos = TextFrameIndex(aResult.breakIndex);
 
@@ -38,6 +38,7 @@
 //#include <com/sun/star/i18n/XBreakIterator.hpp>
 #include <paratr.hxx>
 #include <sal/log.hxx>
+#include <algorithm>
 #include <optional>
 #include <editeng/adjustitem.hxx>
 #include <editeng/charhiddenitem.hxx>
@@ -880,6 +881,7 @@ SwCharRange &SwCharRange::operator+=(const SwCharRange &rRange)
 SwScriptInfo::SwScriptInfo()
     : m_nInvalidityPos(0)
     , m_nDefaultDir(0)
+    , m_eCompressionType(CharCompressType::NONE)
 {
 };
 
@@ -1309,6 +1311,31 @@ void SwScriptInfo::InitScriptInfo(const SwTextNode& rNode,
     // justification type
     const bool bAdjustBlock = SvxAdjust::Block == rParaItems.GetAdjust().GetAdjust();
 
+    // continue from the script changes of the text itself, RTL runs are applied below
+    if (!m_RawScriptChanges.empty())
+        m_ScriptChanges.swap(m_RawScriptChanges);
+    m_RawScriptChanges.clear();
+
+    // The text behind the last change is usually the same as before, and so is
+    // its script and compression information, just shifted. Kashida positions
+    // also depend on the language attributes, so they are always recalculated.
+    const sal_Int32 nOldLen = m_aText.getLength();
+    const sal_Int32 nNewLen = rText.getLength();
+    sal_Int32 nSuffix = 0;
+    if (!bAdjustBlock && aCompEnum == m_eCompressionType)
+    {
+        const sal_Int32 nMaxSuffix = std::min(nOldLen, nNewLen) - sal_Int32(nChg);
+        const sal_Unicode* pOld = m_aText.getStr() + nOldLen;
+        const sal_Unicode* pNew = rText.getStr() + nNewLen;
+        while (nSuffix < nMaxSuffix && pOld[-nSuffix - 1] == pNew[-nSuffix - 1])
+            ++nSuffix;
+    }
+    const TextFrameIndex nTailStart(nNewLen - nSuffix);
+    const TextFrameIndex nDelta(nNewLen - nOldLen);
+    std::vector<ScriptChangeInfo> aOldScriptChanges;
+    std::vector<CompressionChangeInfo> aOldCompressionChanges;
+    size_t nOldScriptIdx = 0;
+
     // FIND INVALID RANGES IN SCRIPT INFO ARRAYS:
 
     if( nChg )
@@ -1370,6 +1397,8 @@ void SwScriptInfo::InitScriptInfo(const SwTextNode& rNode,
     // INVALID DATA FROM THE SCRIPT INFO ARRAYS HAS TO BE DELETED:
 
     // remove invalid entries from script information arrays
+    if (nSuffix)
+        aOldScriptChanges.assign(m_ScriptChanges.begin() + nCnt, m_ScriptChanges.end());
     m_ScriptChanges.erase(m_ScriptChanges.begin() + nCnt, m_ScriptChanges.end());
 
     // get the start of the last compression group
@@ -1386,6 +1415,9 @@ void SwScriptInfo::InitScriptInfo(const SwTextNode& rNode,
     }
 
     // remove invalid entries from compression information arrays
+    if (nSuffix)
+        aOldCompressionChanges.assign(m_CompressionChanges.begin() + nCntComp,
+                                      m_CompressionChanges.end());
     m_CompressionChanges.erase(m_CompressionChanges.begin() + nCntComp,
             m_CompressionChanges.end());
 
@@ -1732,6 +1764,34 @@ void SwScriptInfo::InitScriptInfo(const SwTextNode& rNode,
 
         nLastCompression = nChg;
         nLastKashida = nChg;
+
+        // Once a script change inside of the unchanged end of the text (with
+        // the characters around it) is found at the same place as before,
+        // with the same scripts on both sides, the rest is the same, too.
+        const ScriptChangeInfo& rLast = m_ScriptChanges.back();
+        if (rLast.position == nChg && nChg >= nTailStart + TextFrameIndex(2)
+            && nChg < TextFrameIndex(rText.getLength()))
+        {
+            while (nOldScriptIdx < aOldScriptChanges.size()
+                   && aOldScriptChanges[nOldScriptIdx].position + nDelta < rLast.position)
+                ++nOldScriptIdx;
+            if (nOldScriptIdx + 1 < aOldScriptChanges.size()
+                && aOldScriptChanges[nOldScriptIdx].position + nDelta == rLast.position
+                && aOldScriptChanges[nOldScriptIdx].type == rLast.type
+                && aOldScriptChanges[nOldScriptIdx + 1].type == nScript)
+            {
+                for (size_t i = nOldScriptIdx + 1; i < aOldScriptChanges.size(); ++i)
+                    m_ScriptChanges.emplace_back(aOldScriptChanges[i].position + nDelta,
+                                                 aOldScriptChanges[i].type);
+                for (const CompressionChangeInfo& rComp : aOldCompressionChanges)
+                {
+                    if (rComp.position + nDelta >= nChg)
+                        m_CompressionChanges.emplace_back(rComp.position + nDelta,
+                                                          rComp.length, rComp.type);
+                }
+                break;
+            }
+        }
     }
 
 #if OSL_DEBUG_LEVEL > 0
@@ -1751,6 +1811,9 @@ void SwScriptInfo::InitScriptInfo(const SwTextNode& rNode,
     SAL_WARN_IF( bWrongKash, "sw.core", "Kashida array contains wrong data" );
 #endif
 
+    m_aText = rText;
+    m_eCompressionType = aCompEnum;
+
     // remove invalid entries from direction information arrays
     m_DirectionChanges.clear();
 
@@ -1792,6 +1855,9 @@ void SwScriptInfo::InitScriptInfo(const SwTextNode& rNode,
                 SAL_WARN_IF( nStartPosOfGroup > nStart || GetScriptChg( nScriptIdx ) <= nStart,
                         "sw.core", "Script override with CTL font trouble" );
 
+                if (m_RawScriptChanges.empty())
+                    m_RawScriptChanges = m_ScriptChanges;
+
                 // Check if we have to insert a new script change at
                 // position nStart. If nStartPosOfGroup < nStart,
                 // we have to insert a new script change:
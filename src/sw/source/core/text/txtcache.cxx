@@ -19,11 +19,92 @@
 
 #include "txtcache.hxx"
 #include <txtfrm.hxx>
+#include <flyfrm.hxx>
+#include <pagefrm.hxx>
+#include <rootfrm.hxx>
+#include <sortedobjs.hxx>
+#include <textcachestatistics.hxx>
 #include "porlay.hxx"
 
 #include <sfx2/viewsh.hxx>
 #include <osl/diagnose.h>
 #include <view.hxx>
+#include <wrtsh.hxx>
+
+#include <algorithm>
+
+namespace
+{
+/// Default number of paragraphs cached in addition to the visible ones.
+constexpr sal_uInt16 constTextCacheBudget = 250;
+/// Upper limit of the cache size; the cache index of a frame is a sal_uInt16.
+constexpr sal_uInt16 constMaxTextCacheSize = 60000;
+
+sal_uInt16 g_nTextCacheBudget = constTextCacheBudget;
+sw::TextCacheStatistics g_aTextCacheStatistics;
+
+sal_uInt32 lcl_CountTextFrames(const SwLayoutFrame& rLay)
+{
+    sal_uInt32 nCount = 0;
+    for (const SwFrame* pLow = rLay.Lower(); pLow; pLow = pLow->GetNext())
+    {
+        if (pLow->IsTextFrame())
+            ++nCount;
+        else if (pLow->IsLayoutFrame())
+            nCount += lcl_CountTextFrames(*static_cast<const SwLayoutFrame*>(pLow));
+    }
+    return nCount;
+}
+
+/// Number of paragraphs on the pages visible in the shell; their portions are needed for painting.
+sal_uInt32 lcl_CountVisibleTextFrames(const SwViewShell& rShell)
+{
+    const SwRootFrame* pLayout = rShell.GetLayout();
+    if (!pLayout)
+        return 0;
+
+    sal_uInt32 nCount = 0;
+    const SwRect& rVisArea = rShell.VisArea();
+    for (const SwFrame* pPage = pLayout->Lower(); pPage; pPage = pPage->GetNext())
+    {
+        if (!pPage->getFrameArea().Overlaps(rVisArea))
+            continue;
+
+        nCount += lcl_CountTextFrames(*static_cast<const SwPageFrame*>(pPage));
+        if (const SwSortedObjs* pObjs = static_cast<const SwPageFrame*>(pPage)->GetSortedObjs())
+        {
+            for (const SwAnchoredObject* pObj : *pObjs)
+            {
+                if (const SwFlyFrame* pFly = pObj->DynCastFlyFrame())
+                    nCount += lcl_CountTextFrames(*pFly);
+            }
+        }
+    }
+    return nCount;
+}
+}
+
+namespace sw
+{
+TextCacheStatistics GetTextCacheStatistics()
+{
+    TextCacheStatistics aStatistics(g_aTextCacheStatistics);
+    aStatistics.m_nBudget = g_nTextCacheBudget;
+    if (SwCache* pCache = SwTextFrame::GetTextCache())
+        aStatistics.m_nMaxEntries = pCache->GetCurMax();
+    return aStatistics;
+}
+
+void SetTextCacheBudget(sal_uInt16 const nBudget)
+{
+    g_nTextCacheBudget = nBudget;
+}
+
+void CountTextCacheReformat()
+{
+    ++g_aTextCacheStatistics.m_nReformats;
+}
+}
 
 SwTextLine::SwTextLine( SwTextFrame const *pFrame, std::unique_ptr<SwParaPortion> pNew ) :
     SwCacheObj( static_cast<void const *>(pFrame) ),
@@ -79,11 +160,15 @@ bool SwTextFrame::HasPara_() const
     if ( pTextLine )
     {
         if ( pTextLine->GetPara() )
+        {
+            ++g_aTextCacheStatistics.m_nHits;
             return true;
+        }
     }
     else
         const_cast<SwTextFrame*>(this)->mnCacheIndex = USHRT_MAX;
 
+    ++g_aTextCacheStatistics.m_nMisses;
     return false;
 }
 
@@ -158,29 +243,42 @@ void SwTextFrame::SetPara( SwParaPortion *pNew, bool bDelete )
 /** Prevent the SwParaPortions of the *visible* paragraphs from being deleted;
     they would just be recreated on the next paint.
 
-    Heuristic: 100 per view are visible
+    The paragraphs on the visible pages of all views are preserved, but at
+    least 100 per view.
 
-    If the cache is too small, enlarge it to ensure there are sufficient free
-    entries for the layout so it doesn't have to throw away a node's
-    SwParaPortion when it starts formatting the next node.
+    Beyond that the cache keeps the number of paragraphs set by
+    sw::SetTextCacheBudget(), which also leaves enough free entries for the
+    layout so it doesn't have to throw away a node's SwParaPortion when it
+    starts formatting the next node.
 */
 SwSaveSetLRUOfst::SwSaveSetLRUOfst()
 {
-    sal_uInt16 nVisibleShells(0);
+    sal_uInt32 nVisibleShells(0);
+    sal_uInt32 nVisibleParas(0);
     for (auto pView = SfxViewShell::GetFirst(true, checkSfxViewShell<SwView>);
          pView != nullptr;
          pView = SfxViewShell::GetNext(*pView, true, checkSfxViewShell<SwView>))
     {
-        // Apparently we are not interested here what document pView is for, but only in the
-        // total number of shells in the process?
+        // The cache is shared by all documents, so count the views of all of them.
         ++nVisibleShells;
+        if (const SwWrtShell* pShell = static_cast<SwView*>(pView)->GetWrtShellPtr())
+            nVisibleParas += lcl_CountVisibleTextFrames(*pShell);
     }
 
-    sal_uInt16 const nPreserved(100 * nVisibleShells);
+    sal_uInt16 const nPreserved(std::min<sal_uInt32>(
+        std::max(100 * nVisibleShells, nVisibleParas), constMaxTextCacheSize / 2));
     SwCache & rCache(*SwTextFrame::GetTextCache());
-    if (rCache.GetCurMax() < nPreserved + 250)
+    sal_uInt16 const nMax(std::min<sal_uInt32>(sal_uInt32(nPreserved) + g_nTextCacheBudget,
+                                               constMaxTextCacheSize));
+    if (rCache.GetCurMax() < nMax)
+    {
+        rCache.IncreaseMax(nMax - rCache.GetCurMax());
+    }
+    else if (rCache.GetCurMax() > nMax)
     {
-        rCache.IncreaseMax(nPreserved + 250 - rCache.GetCurMax());
+        // the least recently used entries beyond the new maximum are dropped
+        rCache.DecreaseMax(rCache.GetCurMax() - nMax);
+        rCache.ShrinkToMax();
     }
     rCache.SetLRUOfst(nPreserved);
 }
@@ -62,4 +62,10 @@ public:
     bool IsAvailable() const;
 };
 
+namespace sw
+{
+/// Counts SwTextFrame::GetFormatted() calls that reformat an evicted paragraph.
+void CountTextCacheReformat();
+}
+
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
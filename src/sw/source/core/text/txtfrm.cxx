@@ -3531,8 +3531,12 @@ SwTextFrame* SwTextFrame::GetFormatted( bool bForceQuickFormat )
         // the SwLineLayout that has been deleted from the
         // SwTextFrame::s_pTextCache (hence !HasPara() above).
         // Optimization with FormatQuick()
-        if( bFormat && !FormatQuick( bForceQuickFormat ) )
-            Format(getRootFrame()->GetCurrShell()->GetOut());
+        if( bFormat )
+        {
+            sw::CountTextCacheReformat();
+            if( !FormatQuick( bForceQuickFormat ) )
+                Format(getRootFrame()->GetCurrShell()->GetOut());
+        }
     }
 
     return this;
@@ -32,6 +32,7 @@ namespace sw
 {
 WeakNodeContainer::WeakNodeContainer(SwNode* pNode)
     : m_pNode(pNode)
+    , m_bModified(false)
 {
     if (m_pNode)
     {
@@ -66,8 +67,11 @@ SwNode* WeakNodeContainer::getNode()
     return nullptr;
 }
 
+void WeakNodeContainer::Notify(const SfxHint& /*rHint*/) { m_bModified = true; }
+
 OnlineAccessibilityCheck::OnlineAccessibilityCheck(SwDoc& rDocument)
-    : m_rDocument(rDocument)
+    : m_nNodesStamp(0)
+    , m_rDocument(rDocument)
     , m_aAccessibilityCheck(&m_rDocument)
     , m_nPreviousNodeIndex(-1)
     , m_nAccessibilityIssues(0)
@@ -79,45 +83,92 @@ OnlineAccessibilityCheck::OnlineAccessibilityCheck(SwDoc& rDocument)
 {
 }
 
+sal_uInt64 OnlineAccessibilityCheck::getFormatStamp() const
+{
+    const ContentChangeStamps& rStamps = m_rDocument.GetContentChangeStamps();
+    return sal_uInt64(rStamps.Get(ContentChange::Formats))
+           + rStamps.Get(ContentChange::DrawObjects);
+}
+
 void OnlineAccessibilityCheck::updateNodeStatus(SwNode* pNode, bool bIssueObjectNameChanged)
 {
     if (!pNode->IsContentNode() && !pNode->IsTableNode())
         return;
 
-    m_nAccessibilityIssues = 0;
+    removeNodeStatus(pNode);
 
     if (bIssueObjectNameChanged)
         return;
 
+    auto& rStatus = pNode->getAccessibilityCheckStatus();
+    if (!rStatus.pCollection)
+        return;
+
+    auto pWeakNode = std::make_unique<WeakNodeContainer>(pNode);
+    if (!pWeakNode->isAlive())
+        return;
+
+    NodeEntry& rEntry = m_aNodes[pNode];
+    rEntry.m_pWeakNode = std::move(pWeakNode);
+    rEntry.m_nIssues = rStatus.pCollection->getIssues().size();
+    rEntry.m_nFormatStamp = getFormatStamp();
+    m_nAccessibilityIssues += rEntry.m_nIssues;
+}
+
+void OnlineAccessibilityCheck::removeNodeStatus(SwNode* pNode)
+{
     auto it = m_aNodes.find(pNode);
     if (it == m_aNodes.end())
-    {
-        m_aNodes.emplace(pNode, std::make_unique<WeakNodeContainer>(pNode));
-    }
+        return;
+
+    // the entry may belong to a deleted node, which had the same address
+    m_nAccessibilityIssues -= it->second.m_nIssues;
+    m_aNodes.erase(it);
+}
+
+void OnlineAccessibilityCheck::removeDeletedNodes()
+{
+    // nodes can only be deleted, if the nodes array changed
+    sal_uInt32 nNodesStamp = m_rDocument.GetContentChangeStamps().Get(ContentChange::Nodes);
+    if (nNodesStamp == m_nNodesStamp)
+        return;
+    m_nNodesStamp = nNodesStamp;
 
-    for (auto iterator = m_aNodes.begin(); iterator != m_aNodes.end();)
+    for (auto it = m_aNodes.begin(); it != m_aNodes.end();)
     {
-        auto& pWeakContentNode = iterator->second;
-        if (pWeakContentNode->isAlive())
+        if (it->second.m_pWeakNode->isAlive())
         {
-            auto& rStatus = pWeakContentNode->getNode()->getAccessibilityCheckStatus();
-            if (rStatus.pCollection)
-            {
-                m_nAccessibilityIssues += rStatus.pCollection->getIssues().size();
-                ++iterator;
-            }
-            else
-            {
-                iterator = m_aNodes.erase(iterator);
-            }
+            ++it;
         }
         else
         {
-            iterator = m_aNodes.erase(iterator);
+            m_nAccessibilityIssues -= it->second.m_nIssues;
+            it = m_aNodes.erase(it);
         }
     }
 }
 
+bool OnlineAccessibilityCheck::isNodeStatusOutdated(SwNode* pNode)
+{
+    if (!pNode->getAccessibilityCheckStatus().pCollection)
+        return true;
+
+    auto it = m_aNodes.find(pNode);
+    if (it == m_aNodes.end())
+        return true;
+
+    const NodeEntry& rEntry = it->second;
+    return !rEntry.m_pWeakNode->isAlive() || rEntry.m_pWeakNode->isModified()
+           || rEntry.m_nFormatStamp != getFormatStamp();
+}
+
+sal_Int32 OnlineAccessibilityCheck::getNumberOfAccessibilityIssues()
+{
+    if (m_nAccessibilityIssues >= 0)
+        removeDeletedNodes();
+    return m_nAccessibilityIssues;
+}
+
 void OnlineAccessibilityCheck::updateStatusbar()
 {
     if (SwDocShell* pShell = m_rDocument.GetDocShell())
@@ -264,8 +315,12 @@ void OnlineAccessibilityCheck::lookForPreviousNodeAndUpdate(const SwPosition& rN
 
     if (pNode && (pNode->IsContentNode() || pNode->IsTableNode()))
     {
-        runAccessibilityCheck(pNode);
-        updateNodeStatus(pNode);
+        // Only check the previous node again, if it was changed since its last check
+        if (isNodeStatusOutdated(pNode))
+        {
+            runAccessibilityCheck(pNode);
+            updateNodeStatus(pNode);
+        }
 
         // Assign previous node and index
         m_pPreviousNode = std::move(pCurrentWeak);
@@ -310,7 +365,7 @@ void OnlineAccessibilityCheck::resetAndQueue(SwNode* pNode, bool bIssueObjectNam
         return;
 
     pNode->getAccessibilityCheckStatus().reset();
-    m_aNodes.erase(pNode);
+    removeNodeStatus(pNode);
     if (&pNode->GetNodes() == &m_rDocument.GetNodes()) // don't add undo array
     {
         runAccessibilityCheck(pNode);
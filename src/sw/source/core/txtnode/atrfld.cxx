@@ -556,7 +556,10 @@ void SwTextField::ExpandTextField(const bool bForceNotify) const
         }
     }
     else
+    {
         m_aExpand = aNewExpand;
+        m_pTextNode->GetDoc().GetContentChangeStamps().Changed(sw::ContentChange::Fields);
+    }
 
     const_cast<SwTextField*>(this)->NotifyContentChange( const_cast<SwFormatField&>(GetFormatField()) );
 }
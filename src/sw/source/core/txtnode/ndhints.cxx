@@ -23,6 +23,8 @@
 #include <ndhints.hxx>
 #include <txtatr.hxx>
 
+#include <algorithm>
+
 #ifdef DBG_UTIL
 #include <pam.hxx>
 #include <fmtautofmt.hxx>
@@ -206,6 +208,31 @@ void SwpHints::Insert(SwTextAttr* pHt)
     m_HintsByWhichAndStart.insert(it3, pHt);
 }
 
+void SwpHints::Insert(const std::vector<SwTextAttr*>& rHints)
+{
+    for (SwTextAttr* pHt : rHints)
+    {
+        assert( pHt->m_pHints == nullptr );
+        pHt->m_pHints = this;
+    }
+
+    ResortStartMap();
+    ResortEndMap();
+    ResortWhichMap();
+
+    // append the new hints, sort only them and merge them into the sorted rest
+    auto lcl_InsertSorted = [&rHints](std::vector<SwTextAttr*>& rMap, auto aCompare)
+    {
+        const size_t nOldCount = rMap.size();
+        rMap.insert(rMap.end(), rHints.begin(), rHints.end());
+        std::sort(rMap.begin() + nOldCount, rMap.end(), aCompare);
+        std::inplace_merge(rMap.begin(), rMap.begin() + nOldCount, rMap.end(), aCompare);
+    };
+    lcl_InsertSorted(m_HintsByStart, CompareSwpHtStart);
+    lcl_InsertSorted(m_HintsByEnd, CompareSwpHtEnd());
+    lcl_InsertSorted(m_HintsByWhichAndStart, CompareSwpHtWhichStart());
+}
+
 bool SwpHints::Contains( const SwTextAttr *pHt ) const
 {
     // DO NOT use find() or CHECK here!
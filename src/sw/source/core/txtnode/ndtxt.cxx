@@ -1274,6 +1274,11 @@ void SwTextNode::Update(
 {
     assert(rPos.GetContentNode() == this);
     SetAutoCompleteWordDirty( true );
+    GetDoc().GetContentChangeStamps().Changed(m_bLastOutlineState
+        ? sw::ContentChange::Outline
+        : GetIndex() < GetNodes().GetEndOfExtras().GetIndex()
+            ? sw::ContentChange::OtherText
+            : sw::ContentChange::BodyText);
 
     std::unique_ptr<SwpHts> pCollector;
     const sal_Int32 nChangePos = rPos.GetIndex();
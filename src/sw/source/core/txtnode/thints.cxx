@@ -77,6 +77,8 @@
 #include <algorithm>
 #include <map>
 #include <memory>
+#include <numeric>
+#include <optional>
 
 #include <rdfhelper.hxx>
 #include <hints.hxx>
@@ -1189,6 +1191,7 @@ void SwTextNode::DestroyAttr( SwTextAttr* pAttr )
 
     // some things need to be done before deleting the formatting attribute
     SwDoc& rDoc = GetDoc();
+    rDoc.GetContentChangeStamps().Changed(sw::ContentChange::Hints);
     switch( pAttr->Which() )
     {
     case RES_TXTATR_FLYCNT:
@@ -1343,6 +1346,8 @@ bool SwTextNode::InsertHint( SwTextAttr * const pAttr, const SetAttrMode nMode )
     assert(pAttr && pAttr->GetStart() <= Len());
     assert(!pAttr->GetEnd() || (*pAttr->GetEnd() <= Len()));
 
+    GetDoc().GetContentChangeStamps().Changed(sw::ContentChange::Hints);
+
     // translate from SetAttrMode to InsertMode (for hints with CH_TXTATR)
     const SwInsertFlags nInsertFlags =
         (nMode & SetAttrMode::NOHINTEXPAND)
@@ -2043,6 +2048,208 @@ bool SwTextNode::SetAttr(
     return nCount != 0;
 }
 
+bool SwTextNode::InsertCharAttrSpans(
+    const std::vector<sw::CharAttrSpan>& rSpans,
+    const SetAttrMode nMode )
+{
+    if ( rSpans.empty() )
+        return false;
+
+    sal_Int32 nMin = m_Text.getLength();
+    sal_Int32 nMax = 0;
+    bool bBulk = !(nMode & SetAttrMode::NOHINTADJUST);
+    for ( const sw::CharAttrSpan& rSpan : rSpans )
+    {
+        assert( rSpan.pSet && 0 <= rSpan.nStart && rSpan.nStart <= rSpan.nEnd
+                && rSpan.nEnd <= m_Text.getLength() );
+        nMin = std::min( nMin, rSpan.nStart );
+        nMax = std::max( nMax, rSpan.nEnd );
+
+        // SetAttr() sets a span covering the whole paragraph at the
+        // paragraph itself, and no-length spans don't build portions
+        if ( rSpan.nStart == rSpan.nEnd ||
+             ( !rSpan.nStart && rSpan.nEnd == m_Text.getLength() &&
+               !(nMode & SetAttrMode::NOFORMATATTR) ) )
+        {
+            bBulk = false;
+        }
+
+        SfxItemIter aIter( *rSpan.pSet );
+        for ( const SfxPoolItem* pItem = aIter.GetCurItem(); bBulk && pItem;
+              pItem = aIter.NextItem() )
+        {
+            if ( !IsInvalidItem( pItem ) && !isCHRATR( pItem->Which() ) &&
+                 RES_TXTATR_UNKNOWN_CONTAINER != pItem->Which() )
+            {
+                bBulk = false;
+            }
+        }
+    }
+
+    // Existing portions in the range would have to be split and merged with
+    // the new ones, and input fields or content controls may widen the new
+    // hints: leave all of that to InsertHint().
+    if ( bBulk && HasHints() )
+    {
+        for ( size_t i = 0; bBulk && i < m_pSwpHints->Count(); ++i )
+        {
+            const SwTextAttr* pHt = m_pSwpHints->Get( i );
+            const sal_uInt16 nWhich = pHt->Which();
+            if ( RES_TXTATR_INPUTFIELD == nWhich ||
+                 RES_TXTATR_CONTENTCONTROL == nWhich )
+            {
+                bBulk = false;
+            }
+            else if ( ( RES_TXTATR_CHARFMT == nWhich ||
+                        RES_TXTATR_AUTOFMT == nWhich ) &&
+                      pHt->GetStart() < nMax && nMin < *pHt->GetEnd() )
+            {
+                bBulk = false;
+            }
+        }
+    }
+
+    auto lcl_SetEachSpan = [&]()
+    {
+        bool bRet = false;
+        for ( const sw::CharAttrSpan& rSpan : rSpans )
+        {
+            if ( SetAttr( *rSpan.pSet, rSpan.nStart, rSpan.nEnd, nMode ) )
+                bRet = true;
+        }
+        return bRet;
+    };
+
+    if ( !bBulk )
+        return lcl_SetEachSpan();
+
+    // Cut the spans into portions at every start and end position, and merge
+    // the attributes of all spans covering a portion into one set.
+    std::vector<sal_Int32> aBounds;
+    aBounds.reserve( 2 * rSpans.size() );
+    for ( const sw::CharAttrSpan& rSpan : rSpans )
+    {
+        aBounds.push_back( rSpan.nStart );
+        aBounds.push_back( rSpan.nEnd );
+    }
+    std::sort( aBounds.begin(), aBounds.end() );
+    aBounds.erase( std::unique( aBounds.begin(), aBounds.end() ), aBounds.end() );
+
+    std::vector<size_t> aByStart( rSpans.size() );
+    std::iota( aByStart.begin(), aByStart.end(), 0 );
+    std::stable_sort( aByStart.begin(), aByStart.end(),
+        [&rSpans]( size_t n1, size_t n2 ) { return rSpans[n1].nStart < rSpans[n2].nStart; } );
+
+    SwDoc& rDoc = GetDoc();
+    const bool bDontReplace( nMode & SetAttrMode::DONTREPLACE );
+    std::vector<size_t> aActive; // spans covering the current portion, in batch order
+    size_t nNextSpan = 0;
+    std::optional<SfxItemSet> oLastSet;
+    sal_Int32 nLastStart = 0;
+    sal_Int32 nLastEnd = 0;
+    std::vector<SwTextAttr*> aNewHints;
+    std::vector<sal_uInt16> aWhichSublist;
+
+    auto lcl_AddPortion = [&]()
+    {
+        if ( !oLastSet )
+            return;
+        std::vector<sal_uInt16> aWhichs;
+        oLastSet->CollectHasItems( aWhichs );
+        aWhichSublist.insert( aWhichSublist.end(), aWhichs.begin(), aWhichs.end() );
+        aNewHints.push_back( MakeTextAttr( rDoc, *oLastSet, nLastStart, nLastEnd ) );
+        oLastSet.reset();
+    };
+
+    for ( size_t nBound = 0; nBound + 1 < aBounds.size(); ++nBound )
+    {
+        const sal_Int32 nPorStart = aBounds[nBound];
+        const sal_Int32 nPorEnd = aBounds[nBound + 1];
+
+        std::erase_if( aActive,
+            [&rSpans, nPorStart]( size_t n ) { return rSpans[n].nEnd <= nPorStart; } );
+        while ( nNextSpan < aByStart.size() &&
+                rSpans[aByStart[nNextSpan]].nStart == nPorStart )
+        {
+            const size_t n = aByStart[nNextSpan++];
+            aActive.insert( std::lower_bound( aActive.begin(), aActive.end(), n ), n );
+        }
+
+        // like SetAttr() span by span: the last Put() wins, so with
+        // DONTREPLACE put the spans in reverse to let the first one win
+        SfxItemSet aPorSet( rDoc.GetAttrPool(), aCharAutoFormatSetRange );
+        if ( bDontReplace )
+        {
+            for ( auto it = aActive.rbegin(); it != aActive.rend(); ++it )
+                aPorSet.Put( *rSpans[*it].pSet );
+        }
+        else
+        {
+            for ( size_t n : aActive )
+                aPorSet.Put( *rSpans[n].pSet );
+        }
+
+        // extend the previous portion if the attributes are the same
+        if ( oLastSet && nLastEnd == nPorStart && *oLastSet == aPorSet )
+        {
+            nLastEnd = nPorEnd;
+            continue;
+        }
+
+        lcl_AddPortion();
+        if ( aPorSet.Count() )
+        {
+            oLastSet.emplace( std::move( aPorSet ) );
+            nLastStart = nPorStart;
+            nLastEnd = nPorEnd;
+        }
+    }
+    lcl_AddPortion();
+
+    if ( aNewHints.empty() )
+        return false;
+
+    // InsertHint() refuses hints beyond MAX_HINTS one by one; let it do so
+    const size_t nOldCount = HasHints() ? m_pSwpHints->Count() : 0;
+    if ( SwpHints::MAX_HINTS <= nOldCount ||
+         SwpHints::MAX_HINTS - nOldCount < aNewHints.size() )
+    {
+        for ( SwTextAttr* pNew : aNewHints )
+            DestroyAttr( pNew );
+        return lcl_SetEachSpan();
+    }
+
+    rDoc.GetContentChangeStamps().Changed(sw::ContentChange::Hints);
+    GetOrCreateSwpHints();
+
+    for ( SwTextAttr* pNew : aNewHints )
+    {
+        if ( SetAttrMode::DONTEXPAND & nMode )
+            pNew->SetDontExpand( true );
+        if ( CharFormat::GetItem( *pNew, RES_CHRATR_HIDDEN ) )
+            SetCalcHiddenCharFlags();
+    }
+
+    m_pSwpHints->Insert( aNewHints );
+    for ( SwTextAttr* pNew : aNewHints )
+        m_pSwpHints->NoteInHistory( pNew, true );
+
+    // one merge for all new portions, like InsertHint() does for each
+    if ( !rDoc.IsInXMLImport() )
+        m_pSwpHints->MergePortions( *this );
+
+    if ( HasWriterListeners() )
+    {
+        std::sort( aWhichSublist.begin(), aWhichSublist.end() );
+        aWhichSublist.erase( std::unique( aWhichSublist.begin(), aWhichSublist.end() ),
+                             aWhichSublist.end() );
+        const SwUpdateAttr aHint( nMin, nMax, RES_TXTATR_AUTOFMT, std::move( aWhichSublist ) );
+        TriggerNodeUpdate( sw::LegacyModifyHint( &aHint, &aHint ) );
+    }
+
+    return true;
+}
+
 static void lcl_MergeAttr( SfxItemSet& rSet, const SfxPoolItem& rAttr )
 {
     if ( RES_TXTATR_AUTOFMT == rAttr.Which() )
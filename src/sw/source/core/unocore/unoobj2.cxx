@@ -170,13 +170,12 @@ void CollectFrameAtNode( const SwNode& rNd,
     }
     else
     {
-        for(sw::SpzFrameFormat* pSpz: *rDoc.GetSpzFrameFormats())
+        // the node knows its anchored flys; avoid scanning all of the
+        // document's frame formats for every paragraph
+        for(SwFrameFormat* pFlyFormat: rNd.GetAnchoredFlys())
         {
-            const SwFormatAnchor& rAnchor = pSpz->GetAnchor();
-            const SwNode* pAnchorNode;
-            if( rAnchor.GetAnchorId() == nChkType &&
-                nullptr != (pAnchorNode = rAnchor.GetAnchorNode()) &&
-                    *pAnchorNode == rNd )
+            const SwFormatAnchor& rAnchor = pFlyFormat->GetAnchor();
+            if( rAnchor.GetAnchorId() == nChkType )
             {
 
                 // OD 2004-05-07 #i28701# - determine insert position for
@@ -184,7 +183,7 @@ void CollectFrameAtNode( const SwNode& rNd,
                 const sal_Int32 nIndex = rAnchor.GetAnchorContentOffset();
                 sal_uInt32 nOrder = rAnchor.GetOrder();
 
-                rFrames.emplace_back(nIndex, nOrder, std::make_unique<sw::FrameClient>(pSpz));
+                rFrames.emplace_back(nIndex, nOrder, std::make_unique<sw::FrameClient>(pFlyFormat));
             }
         }
         std::sort(rFrames.begin(), rFrames.end(), FrameClientSortListLess());
@@ -267,10 +267,17 @@ namespace
         SwPosition aEndOfPara( rPtNd, rPtNd.Len() );
         const IDocumentMarkAccess::const_iterator_t pCandidatesEnd =
             pMarkAccess->findFirstAnnotationStartsAfter(aEndOfPara);
+        // ... nor annotation marks starting before the paragraph; the marks
+        // are sorted by start, so enumerating all paragraphs stays linear
+        const SwPosition aStartOfPara( rPtNd, 0 );
+        const IDocumentMarkAccess::const_iterator_t pCandidatesStart = std::lower_bound(
+            pMarkAccess->getAnnotationMarksBegin(), pCandidatesEnd, aStartOfPara,
+            [](const ::sw::mark::IMark* pMark, const SwPosition& rPos)
+            { return pMark->GetMarkStart() < rPos; });
 
         // search for all annotation marks that have its start position in this paragraph
         const SwNode& rOwnNode = rUnoCursor.GetPoint()->GetNode();
-        for( IDocumentMarkAccess::const_iterator_t ppMark = pMarkAccess->getAnnotationMarksBegin();
+        for( IDocumentMarkAccess::const_iterator_t ppMark = pCandidatesStart;
              ppMark != pCandidatesEnd;
              ++ppMark )
         {
@@ -1133,6 +1140,10 @@ static void lcl_FillRedlineArray(
     {
         const SwRangeRedline* pRedline = rRedTable[nRed];
         auto [pRedStart, pRedEnd]= pRedline->StartEnd();
+        // the table is sorted by start position: no later redline can start
+        // or end in this node, so don't visit the rest of the document
+        if ( pRedStart->GetNode() > rOwnNode )
+            break;
         if ( rOwnNode == pRedStart->GetNode() )
             rRedArr.insert( std::make_shared<SwXRedlinePortion_Impl>(
                 pRedline, true ) );
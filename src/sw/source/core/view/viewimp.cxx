@@ -39,6 +39,11 @@
 #include <prevwpage.hxx>
 #include <sfx2/viewsh.hxx>
 
+#include <algorithm>
+
+/// Number of pending LOK invalidations at which they get merged.
+constexpr size_t LOK_PENDING_INVALIDATIONS_COMPRESS = 64;
+
 void SwViewShellImp::Init( const SwViewOption *pNewOpt )
 {
     OSL_ENSURE( m_pDrawView, "SwViewShellImp::Init without DrawView" );
@@ -168,9 +173,22 @@ void SwViewShellImp::AddPendingLOKInvalidation( const SwRect& rRect )
     std::vector<SwRect>& l = m_pendingLOKInvalidations;
     if(l.empty() && m_pShell && m_pShell->GetSfxViewShell()) // Announce that these invalidations will need flushing.
         m_pShell->GetSfxViewShell()->libreOfficeKitViewAddPendingInvalidateTiles();
-    // These are often repeated, so check first for duplicates.
-    if( std::find( l.begin(), l.end(), rRect ) == l.end())
-        l.push_back( rRect );
+    // These are often repeated or nested, so check first whether it is
+    // already covered, and drop the ones the new one covers.
+    if( std::any_of( l.begin(), l.end(), [&rRect](const SwRect& r) { return r.Contains( rRect ); }))
+        return;
+    std::erase_if( l, [&rRect](const SwRect& r) { return rRect.Contains( r ); });
+    l.push_back( rRect );
+
+    // Heavy edits (table operations, field updates) produce floods of
+    // overlapping rectangles, merge them early to keep the above cheap.
+    if( l.size() >= LOK_PENDING_INVALIDATIONS_COMPRESS )
+    {
+        SwRegionRects aRegion;
+        aRegion.insert( aRegion.end(), l.begin(), l.end());
+        aRegion.Compress( SwRegionRects::CompressFuzzy );
+        l.assign( aRegion.begin(), aRegion.end());
+    }
 }
 
 std::vector<SwRect> SwViewShellImp::TakePendingLOKInvalidations()
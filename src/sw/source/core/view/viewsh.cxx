@@ -86,6 +86,7 @@
 
 #include <frameformats.hxx>
 #include <fmtcntnt.hxx>
+#include <algorithm>
 
 bool SwViewShell::sbLstAct = false;
 ShellResource *SwViewShell::spShellRes = nullptr;
@@ -608,6 +609,81 @@ void SwViewShell::InvalidateWindows( const SwRect &rRect )
     }
 }
 
+namespace
+{
+/// At most this many rectangles are sent to a client per flush.
+constexpr size_t LOK_MAX_INVALIDATIONS_PER_FLUSH = 32;
+/// Size of a 256px tile at 100% zoom, for the statistics.
+constexpr tools::Long LOK_TILE_TWIPS = 3840;
+
+/// Rectangles following each other by Top that are considered for merging.
+constexpr size_t LOK_MERGE_CANDIDATES = 8;
+
+sal_Int64 lcl_Area(const SwRect& rRect)
+{
+    return sal_Int64(rRect.Width()) * rRect.Height();
+}
+
+/// Area that merging the two rectangles would invalidate in addition.
+sal_Int64 lcl_MergeCost(const SwRect& rA, const SwRect& rB)
+{
+    sal_Int64 nCost = lcl_Area(rA.GetUnion(rB)) - lcl_Area(rA) - lcl_Area(rB);
+    if (rA.Overlaps(rB))
+        nCost += lcl_Area(rA.GetIntersection(rB));
+    return nCost;
+}
+
+/// Merge rectangles until the budget is met, overlapping and close ones
+/// first: a few slightly larger rectangles are cheaper for the client than
+/// re-rendering the same tiles for many small ones.
+void lcl_LimitLOKInvalidations(SwRegionRects& rRects)
+{
+    if (rRects.size() <= LOK_MAX_INVALIDATIONS_PER_FLUSH)
+        return;
+
+    std::sort(rRects.begin(), rRects.end(),
+              [](const SwRect& rA, const SwRect& rB) { return rA.Top() < rB.Top(); });
+    while (rRects.size() > LOK_MAX_INVALIDATIONS_PER_FLUSH)
+    {
+        size_t nBestA = 0;
+        size_t nBestB = 1;
+        sal_Int64 nBestCost = SAL_MAX_INT64;
+        for (size_t i = 0; i + 1 < rRects.size(); ++i)
+        {
+            const size_t nEnd = std::min(rRects.size(), i + 1 + LOK_MERGE_CANDIDATES);
+            for (size_t j = i + 1; j < nEnd; ++j)
+            {
+                const sal_Int64 nCost = lcl_MergeCost(rRects[i], rRects[j]);
+                if (nCost < nBestCost)
+                {
+                    nBestA = i;
+                    nBestB = j;
+                    nBestCost = nCost;
+                }
+            }
+        }
+        // the merged rectangle keeps the Top of the first one, so the
+        // rectangles stay sorted
+        rRects[nBestA].Union(rRects[nBestB]);
+        rRects.erase(rRects.begin() + nBestB);
+    }
+}
+
+sal_uInt64 lcl_CountLOKTiles(const SwRegionRects& rRects)
+{
+    sal_uInt64 nTiles = 0;
+    for (const SwRect& rRect : rRects)
+    {
+        if (rRect.IsEmpty())
+            continue;
+        const tools::Long nCols = rRect.Right() / LOK_TILE_TWIPS - rRect.Left() / LOK_TILE_TWIPS + 1;
+        const tools::Long nRows = rRect.Bottom() / LOK_TILE_TWIPS - rRect.Top() / LOK_TILE_TWIPS + 1;
+        nTiles += nCols * nRows;
+    }
+    return nTiles;
+}
+}
+
 void SwViewShell::FlushPendingLOKInvalidateTiles()
 {
     assert(comphelper::LibreOfficeKit::isActive());
@@ -617,9 +693,16 @@ void SwViewShell::FlushPendingLOKInvalidateTiles()
         std::vector<SwRect> tmpRects = rSh.Imp()->TakePendingLOKInvalidations();
         rects.insert( rects.end(), tmpRects.begin(), tmpRects.end());
     }
+    const size_t nCollected = rects.size();
     rects.Compress( SwRegionRects::CompressFuzzy );
     if(rects.empty())
         return;
+    lcl_LimitLOKInvalidations( rects );
+
+    const sal_uInt64 nTiles = lcl_CountLOKTiles( rects );
+    SAL_INFO("sw.tiled", "FlushPendingLOKInvalidateTiles: " << nCollected << " rectangles merged into "
+                        << rects.size() << ", " << nTiles << " tiles");
+
     // This is basically the loop from SwViewShell::InvalidateWindows().
     for(SwViewShell& rSh : GetRingContainer())
     {
@@ -634,6 +717,13 @@ void SwViewShell::FlushPendingLOKInvalidateTiles()
             {
                 for( const SwRect& rect : rects )
                     rSh.GetWin()->Invalidate( rect.SVRect() );
+
+                SwLOKInvalidationStats& rStats = rSh.maLOKInvalidationStats;
+                ++rStats.nFlushes;
+                rStats.nCollected += nCollected;
+                rStats.nSent += rects.size();
+                rStats.nTiles += nTiles;
+                rStats.nLastTiles = nTiles;
             }
         }
     }
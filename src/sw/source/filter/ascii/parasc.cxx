@@ -19,6 +19,7 @@
 
 #include <memory>
 
+#include <rtl/ustrbuf.hxx>
 #include <tools/stream.hxx>
 #include <hintids.hxx>
 #include <sfx2/docfile.hxx>
@@ -32,8 +33,11 @@
 #include <doc.hxx>
 #include <IDocumentContentOperations.hxx>
 #include <IDocumentDeviceAccess.hxx>
+#include <IDocumentLayoutAccess.hxx>
 #include <IDocumentStylePoolAccess.hxx>
 #include <pam.hxx>
+#include <ndtxt.hxx>
+#include <frmtool.hxx>
 #include <breakit.hxx>
 #include <swerror.h>
 #include <strings.hrc>
@@ -61,8 +65,20 @@ class SwASCIIParser
     SvtScriptType m_nScript;
     bool m_bNewDoc;
 
+    // Bulk mode: when reading into a new document, the paragraphs are
+    // collected in m_aParaText and the text nodes are created directly in
+    // the nodes array, bypassing the content operations (undo, redlining,
+    // mark and index bookkeeping). The frames are created once at the end.
+    bool m_bBulkInsert;
+    OUStringBuffer m_aParaText;
+    std::optional<SwNodeIndex> m_oFirstBulkNode;
+
     ErrCode ReadChars();
     void InsertText( const OUString& rStr );
+    void SplitNode( bool bAppend = false );
+    void InsertPageBreak();
+    void FlushParagraph();
+    void MakeBulkFrames();
 
     SwASCIIParser(const SwASCIIParser&) = delete;
     SwASCIIParser& operator=(const SwASCIIParser&) = delete;
@@ -112,6 +128,7 @@ SwASCIIParser::SwASCIIParser(SwDoc& rD, const SwPaM& rCursor, SvStream& rIn, boo
     , m_nFileSize(0)
     , m_nScript(SvtScriptType::NONE)
     , m_bNewDoc(bReadNewDoc)
+    , m_bBulkInsert(bReadNewDoc)
 {
     m_oPam.emplace(*rCursor.GetPoint());
     m_pArr.reset(new char[ASC_BUFFLEN + 2]);
@@ -179,6 +196,8 @@ ErrCode SwASCIIParser::CallParser()
     }
 
     ErrCode nError = ReadChars();
+    FlushParagraph();
+    MakeBulkFrames();
 
     if (m_oItemSet)
     {
@@ -394,7 +413,7 @@ ErrCode SwASCIIParser::ReadChars()
                 nLineLen = 0;
                 // We skip the last one at the end
                 if (!m_rInput.eof() || !(pEnd == pStt || (!*pEnd && pEnd == pStt + 1)))
-                    m_rDoc.getIDocumentContentOperations().SplitNode(*m_oPam->GetPoint(), false);
+                    SplitNode();
             }
         }
 
@@ -446,10 +465,8 @@ ErrCode SwASCIIParser::ReadChars()
                         {
                             InsertText( OUString( pLastStt ));
                         }
-                        m_rDoc.getIDocumentContentOperations().SplitNode(*m_oPam->GetPoint(),
-                                                                         false);
-                        m_rDoc.getIDocumentContentOperations().InsertPoolItem(
-                            *m_oPam, SvxFormatBreakItem(SvxBreak::PageBefore, RES_BREAK));
+                        SplitNode();
+                        InsertPageBreak();
                         pLastStt = pStt;
                         nLineLen = 0;
                         bIns = false;
@@ -480,7 +497,7 @@ ErrCode SwASCIIParser::ReadChars()
                 sal_Unicode c = *pStt;
                 *pStt = 0;
                 InsertText( OUString( pLastStt ));
-                m_rDoc.getIDocumentContentOperations().SplitNode(*m_oPam->GetPoint(), false);
+                SplitNode();
                 pLastStt = pStt;
                 nLineLen = 0;
                 *pStt = c;
@@ -492,10 +509,7 @@ ErrCode SwASCIIParser::ReadChars()
         {
             // We found a CR/LF, thus save the text
             InsertText( OUString( pLastStt ));
-            if (m_bNewDoc)
-                m_rDoc.getIDocumentContentOperations().AppendTextNode(*m_oPam->GetPoint());
-            else
-                m_rDoc.getIDocumentContentOperations().SplitNode(*m_oPam->GetPoint(), false);
+            SplitNode( m_bNewDoc );
             pLastStt = pStt;
             nLineLen = 0;
         }
@@ -511,11 +525,82 @@ ErrCode SwASCIIParser::ReadChars()
 
 void SwASCIIParser::InsertText( const OUString& rStr )
 {
-    m_rDoc.getIDocumentContentOperations().InsertString(*m_oPam, rStr);
+    if (m_bBulkInsert)
+        m_aParaText.append(rStr);
+    else
+        m_rDoc.getIDocumentContentOperations().InsertString(*m_oPam, rStr);
 
     if (m_oItemSet && g_pBreakIt
         && m_nScript != (SvtScriptType::LATIN | SvtScriptType::ASIAN | SvtScriptType::COMPLEX))
         m_nScript |= g_pBreakIt->GetAllScriptsOfText(rStr);
 }
 
+// Start a new paragraph behind the current one
+void SwASCIIParser::SplitNode( bool bAppend )
+{
+    if (!m_bBulkInsert)
+    {
+        if (bAppend)
+            m_rDoc.getIDocumentContentOperations().AppendTextNode(*m_oPam->GetPoint());
+        else
+            m_rDoc.getIDocumentContentOperations().SplitNode(*m_oPam->GetPoint(), false);
+        return;
+    }
+
+    FlushParagraph();
+
+    SwTextNode* pTextNd = m_oPam->GetPoint()->GetNode().GetTextNode();
+    OSL_ENSURE(pTextNd, "ASCII import: no TextNode at the insert position");
+    if (!pTextNd)
+        return;
+
+    // no frames here, they are created for the whole range in MakeBulkFrames
+    SwNodeIndex aNext(*pTextNd, 1);
+    SwTextNode* pNewNd
+        = m_rDoc.GetNodes().MakeTextNode(aNext.GetNode(), pTextNd->GetTextColl(), false);
+    if (!m_oFirstBulkNode)
+        m_oFirstBulkNode.emplace(*pNewNd);
+    m_oPam->GetPoint()->Assign(*pNewNd);
+}
+
+void SwASCIIParser::InsertPageBreak()
+{
+    const SvxFormatBreakItem aBreak(SvxBreak::PageBefore, RES_BREAK);
+    if (!m_bBulkInsert)
+    {
+        m_rDoc.getIDocumentContentOperations().InsertPoolItem(*m_oPam, aBreak);
+        return;
+    }
+    if (SwTextNode* pTextNd = m_oPam->GetPoint()->GetNode().GetTextNode())
+        pTextNd->SetAttr(aBreak);
+}
+
+// Move the collected text of the current paragraph into its node
+void SwASCIIParser::FlushParagraph()
+{
+    if (!m_bBulkInsert || m_aParaText.isEmpty())
+        return;
+
+    SwTextNode* pTextNd = m_oPam->GetPoint()->GetNode().GetTextNode();
+    if (pTextNd)
+    {
+        pTextNd->InsertText(m_aParaText.makeStringAndClear(), *m_oPam->GetPoint(),
+                            SwInsertFlags::EMPTYEXPAND);
+    }
+    else
+        m_aParaText.setLength(0);
+}
+
+// The nodes created in bulk mode have no frames yet; normally the layout is
+// created after the import, but if there is one already, add all frames at once.
+void SwASCIIParser::MakeBulkFrames()
+{
+    if (!m_oFirstBulkNode || !m_rDoc.getIDocumentLayoutAccess().GetCurrentViewShell())
+        return;
+
+    SwNodeIndex aEnd(m_oPam->GetPoint()->GetNode(), 1);
+    ::MakeFrames(&m_rDoc, m_oFirstBulkNode->GetNode(), aEnd.GetNode());
+    m_oFirstBulkNode.reset();
+}
+
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
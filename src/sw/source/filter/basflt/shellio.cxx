@@ -43,6 +43,7 @@
 #include <IDocumentSettingAccess.hxx>
 #include <IDocumentDeviceAccess.hxx>
 #include <IDocumentLinksAdministration.hxx>
+#include <IDocumentMarkAccess.hxx>
 #include <IDocumentRedlineAccess.hxx>
 #include <IDocumentFieldsAccess.hxx>
 #include <IDocumentState.hxx>
@@ -122,6 +123,9 @@ ErrCodeMsg SwReader::Read( const Reader& rOptions )
             && (mpMedium->GetFilter()->GetUserData() == FILTER_RTF
                 || mpMedium->GetFilter()->GetUserData() == sRtfWH
                 || mpMedium->GetFilter()->GetUserData() == FILTER_DOCX));
+    // bookmarks are usually created in bulk by the import filters; note that
+    // loading DOCX and RTF files goes through writerfilter, not through here
+    mxDoc->getIDocumentMarkAccess()->startBulkInsert();
 
     SwPaM *pPam;
     if( mpCursor )
@@ -338,6 +342,7 @@ ErrCodeMsg SwReader::Read( const Reader& rOptions )
     // case (redlines, flys, footnotes, header/footer) so just do every node.
     mxDoc->GetNodes().ForEach(&sw_MergePortions);
 
+    mxDoc->getIDocumentMarkAccess()->endBulkInsert();
     mxDoc->SetInReading( false );
     mxDoc->SetInXMLImport( false );
     mxDoc->SetInWriterfilterImport(false);
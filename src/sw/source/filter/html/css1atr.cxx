@@ -95,6 +95,7 @@
 #include <o3tl/unit_conversion.hxx>
 
 #include <rtl/strbuf.hxx>
+#include <tools/stream.hxx>
 #include <osl/diagnose.h>
 
 using namespace css;
@@ -168,6 +169,9 @@ const char cCSS1_style_opt_end  = '\"';
 
 const char* const sHTML_FTN_fontheight = "57%";
 
+/// Number of different values of a character attribute whose span tags are reused.
+constexpr size_t MAX_CSS1_SPAN_TAGS = 32;
+
 OString lclConvToHex(sal_uInt16 nHex)
 {
     char aNToABuf[] = "00";
@@ -3645,13 +3649,47 @@ void SwHTMLWriter::OutCSS1_SfxItemSet( const SfxItemSet& rItemSet,
 
 SwHTMLWriter& OutCSS1_HintSpanTag( SwHTMLWriter& rWrt, const SfxPoolItem& rHt )
 {
-    SwCSS1OutMode aMode( rWrt, CSS1_OUTMODE_SPAN_TAG |
-                                   CSS1_OUTMODE_ENCODE|CSS1_OUTMODE_HINT, nullptr );
+    // The same character attributes are used over and over again, so reuse
+    // the tag written for an equal attribute. A background may write a
+    // graphic, so it is always written again.
+    std::vector<std::pair<std::unique_ptr<SfxPoolItem>, OString>>* pTags = nullptr;
+    SvMemoryStream aTagStrm;
+    SvStream* pOldStrm = nullptr;
+    if( rWrt.m_bTagOn && isCHRATR( rHt.Which() ) && RES_CHRATR_BACKGROUND != rHt.Which() )
+    {
+        pTags = &rWrt.m_aCSS1SpanTags[std::make_pair( rHt.Which(), rWrt.m_nCSS1Script )];
+        for( const auto& rTag : *pTags )
+        {
+            if( *rTag.first == rHt )
+            {
+                rWrt.m_bFirstCSS1Property = rTag.second.isEmpty();
+                rWrt.Strm().WriteOString( rTag.second );
+                return rWrt;
+            }
+        }
 
-    Out( aCSS1AttrFnTab, rHt, rWrt );
+        pOldStrm = &rWrt.Strm();
+        rWrt.SetStream( &aTagStrm );
+    }
 
-    if( !rWrt.m_bFirstCSS1Property  && rWrt.m_bTagOn )
-        rWrt.Strm().WriteOString( sCSS1_span_tag_end );
+    {
+        SwCSS1OutMode aMode( rWrt, CSS1_OUTMODE_SPAN_TAG |
+                                       CSS1_OUTMODE_ENCODE|CSS1_OUTMODE_HINT, nullptr );
+
+        Out( aCSS1AttrFnTab, rHt, rWrt );
+
+        if( !rWrt.m_bFirstCSS1Property  && rWrt.m_bTagOn )
+            rWrt.Strm().WriteOString( sCSS1_span_tag_end );
+    }
+
+    if( pTags )
+    {
+        rWrt.SetStream( pOldStrm );
+        OString aTag( static_cast<const char*>(aTagStrm.GetData()), aTagStrm.Tell() );
+        rWrt.Strm().WriteOString( aTag );
+        if( pTags->size() < MAX_CSS1_SPAN_TAGS )
+            pTags->emplace_back( rHt.Clone(), aTag );
+    }
 
     return rWrt;
 }
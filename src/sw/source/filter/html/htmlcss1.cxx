@@ -685,6 +685,10 @@ void SwCSS1Parser::StyleParsed( const CSS1Selector *pSelector,
                                 SfxItemSet& rItemSet,
                                 SvxCSS1PropertyInfo& rPropInfo )
 {
+    // a new style may change the formats found for a class
+    m_aTextFormatColls.clear();
+    m_aCharFormats.clear();
+
     if( !m_bIsNewDoc )
         return;
 
@@ -1117,6 +1121,11 @@ const FontList *SwCSS1Parser::GetFontList() const
 
 SwCharFormat* SwCSS1Parser::GetChrFormat( HtmlTokenId nToken2, const OUString& rClass ) const
 {
+    auto aCacheKey = std::make_pair( nToken2, rClass );
+    auto it = m_aCharFormats.find( aCacheKey );
+    if( it != m_aCharFormats.end() )
+        return it->second;
+
     // search the corresponding style
     sal_uInt16 nPoolId = 0;
     const char* sName = nullptr;
@@ -1192,6 +1201,7 @@ SwCharFormat* SwCSS1Parser::GetChrFormat( HtmlTokenId nToken2, const OUString& r
         }
     }
 
+    m_aCharFormats.emplace( std::move(aCacheKey), pCFormat );
     return pCFormat;
 }
 
@@ -1233,6 +1243,11 @@ SwCharFormat *SwCSS1Parser::GetCharFormatFromPool( sal_uInt16 nPoolId ) const
 SwTextFormatColl *SwCSS1Parser::GetTextFormatColl( sal_uInt16 nTextColl,
                                            const OUString& rClass )
 {
+    auto aCacheKey = std::make_pair( nTextColl, rClass );
+    auto it = m_aTextFormatColls.find( aCacheKey );
+    if( it != m_aTextFormatColls.end() )
+        return it->second;
+
     SwTextFormatColl* pColl = nullptr;
 
     OUString aClass( rClass );
@@ -1308,6 +1323,7 @@ SwTextFormatColl *SwCSS1Parser::GetTextFormatColl( sal_uInt16 nTextColl,
     if( pColl )
         lcl_swcss1_setEncoding( *pColl, GetDfltEncoding() );
 
+    m_aTextFormatColls.emplace( std::move(aCacheKey), pColl );
     return pColl;
 }
 
@@ -22,7 +22,9 @@
 
 #include <sal/config.h>
 
+#include <map>
 #include <string_view>
+#include <utility>
 
 #include <svtools/htmltokn.h>
 #include <tools/solar.h>
@@ -68,6 +70,12 @@ class SwCSS1Parser : public SvxCSS1Parser
 
     bool m_bLinkCharFormatsSet : 1;
 
+    // Results of GetTextFormatColl() and GetChrFormat() by style and class.
+    // Finding the class styles by name is expensive with many styles, so they
+    // are only searched once, until the next style is parsed.
+    std::map<std::pair<sal_uInt16, OUString>, SwTextFormatColl*> m_aTextFormatColls;
+    mutable std::map<std::pair<HtmlTokenId, OUString>, SwCharFormat*> m_aCharFormats;
+
     const SwPageDesc* GetPageDesc( sal_uInt16 nPoolId, bool bCreate );
 
     void SetTableTextColl( bool bHeader );
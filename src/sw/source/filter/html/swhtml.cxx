@@ -326,6 +326,7 @@ SwHTMLParser::SwHTMLParser( SwDoc* pD, SwPaM& rCursor, SvStream& rIn,
 
     m_nEventId = nullptr;
     m_bUpperSpace = m_bViewCreated = m_bChkJumpMark = false;
+    m_bHeadless = Application::IsHeadlessModeEnabled();
 
     m_eScriptLang = HTMLScriptLanguage::Unknown;
 
@@ -2580,6 +2581,19 @@ void SwHTMLParser::Show()
     // - and a StartAction is called
 
     OSL_ENSURE( SvParserState::Working==eState, "Show not in working state - That can go wrong" );
+    if( m_bHeadless )
+    {
+        // the document is formatted once at the end of the import
+        if( ( m_xDoc->GetDocShell() && m_xDoc->GetDocShell()->IsAbortingImport() )
+            || 1 == m_xDoc->getReferenceCount() )
+        {
+            // was the import aborted by SFX?
+            eState = SvParserState::Error;
+        }
+        m_nParaCnt = 50;
+        return;
+    }
+
     SwViewShell *pOldVSh = CallEndAction();
 
     Application::Reschedule();
@@ -2619,7 +2633,8 @@ void SwHTMLParser::ShowStatline()
     }
     else
     {
-        Application::Reschedule();
+        if( !m_bHeadless )
+            Application::Reschedule();
 
         if( ( m_xDoc->GetDocShell() && m_xDoc->GetDocShell()->IsAbortingImport() )
             || 1 == m_xDoc->getReferenceCount() )
@@ -2627,7 +2642,7 @@ void SwHTMLParser::ShowStatline()
             eState = SvParserState::Error;
 
         SwViewShell *pVSh = CheckActionViewShell();
-        if( pVSh && pVSh->HasInvalidRect() )
+        if( pVSh && pVSh->HasInvalidRect() && !m_bHeadless )
         {
             CallEndAction( false, false );
             CallStartAction( pVSh, false );
@@ -2754,6 +2769,33 @@ void SwHTMLParser::SetAttr_( bool bChkEnd, bool bBeforeTable,
 
     std::vector<std::unique_ptr<HTMLAttr>> aFields;
 
+    // Character attributes within one paragraph of a new document are
+    // collected and inserted into the hints of each paragraph at once. They
+    // keep their order and are inserted before the next InsertPoolItem(), so
+    // the result is the same as inserting each one on its own.
+    const bool bCollectCharAttrs = IsNewDoc() &&
+        !m_xDoc->GetIDocumentUndoRedo().DoesUndo() &&
+        !m_xDoc->getIDocumentRedlineAccess().IsRedlineOn();
+    std::deque<SfxItemSet> aCharAttrSets;
+    std::vector<std::pair<SwTextNode*, sw::CharAttrSpan>> aCharAttrSpans;
+    auto lcl_InsertCharAttrSpans = [&aCharAttrSets, &aCharAttrSpans]()
+    {
+        std::stable_sort( aCharAttrSpans.begin(), aCharAttrSpans.end(),
+            []( const auto& rSpan1, const auto& rSpan2 )
+            { return rSpan1.first->GetIndex() < rSpan2.first->GetIndex(); } );
+        std::vector<sw::CharAttrSpan> aSpans;
+        for( auto it = aCharAttrSpans.begin(); it != aCharAttrSpans.end(); )
+        {
+            SwTextNode *const pTextNd = it->first;
+            aSpans.clear();
+            for( ; it != aCharAttrSpans.end() && it->first == pTextNd; ++it )
+                aSpans.push_back( it->second );
+            pTextNd->InsertCharAttrSpans( aSpans, SetAttrMode::DONTREPLACE );
+        }
+        aCharAttrSpans.clear();
+        aCharAttrSets.clear();
+    };
+
     for( auto n = m_aSetAttrTab.size(); n; )
     {
         pAttr = m_aSetAttrTab[ --n ];
@@ -2993,6 +3035,28 @@ void SwHTMLParser::SetAttr_( bool bChkEnd, bool bBeforeTable,
                         m_eJumpTo = JumpToMarks::NONE;
                     }
 
+                    if( bCollectCharAttrs && isCHRATR(nWhich) &&
+                        aAttrPam.GetPoint()->GetNode() == aAttrPam.GetMark()->GetNode() &&
+                        aAttrPam.GetPointNode().IsTextNode() )
+                    {
+                        // Spans covering the whole paragraph are set at the
+                        // paragraph itself, and empty ones aren't set at all.
+                        const sal_Int32 nStart = aAttrPam.Start()->GetContentIndex();
+                        const sal_Int32 nEnd = aAttrPam.End()->GetContentIndex();
+                        SwTextNode *const pTextNd = aAttrPam.GetPointNode().GetTextNode();
+                        if( nStart < nEnd && ( nStart || nEnd < pTextNd->Len() ) )
+                        {
+                            SfxItemSet& rSet = aCharAttrSets.emplace_back( m_xDoc->GetAttrPool(), nWhich, nWhich );
+                            rSet.Put( *pAttr->m_pItem );
+                            aCharAttrSpans.emplace_back( pTextNd, sw::CharAttrSpan{ nStart, nEnd, &rSet } );
+                            aAttrPam.DeleteMark();
+                            delete pAttr;
+                            pAttr = pPrev;
+                            continue;
+                        }
+                    }
+
+                    lcl_InsertCharAttrSpans();
                     m_xDoc->getIDocumentContentOperations().InsertPoolItem( aAttrPam, *pAttr->m_pItem, SetAttrMode::DONTREPLACE );
                 }
                 aAttrPam.DeleteMark();
@@ -3002,6 +3066,7 @@ void SwHTMLParser::SetAttr_( bool bChkEnd, bool bBeforeTable,
             }
         }
     }
+    lcl_InsertCharAttrSpans();
 
     for( auto n = m_aMoveFlyFrames.size(); n; )
     {
@@ -488,6 +488,9 @@ class SwHTMLParser : public SfxHTMLParser, public SvtListener
 
     bool m_bXHTML = false;
     bool m_bReqIF = false;
+    /// Nobody watches the import (batch conversion): don't format, show and
+    /// reschedule in between.
+    bool m_bHeadless = false;
 
     /**
      * Non-owning pointers to already inserted OLE nodes, matching opened
@@ -636,6 +636,7 @@ ErrCode SwHTMLWriter::WriteStream()
 
     m_CharFormatInfos.clear();
     m_TextCollInfos.clear();
+    m_aCSS1SpanTags.clear();
     m_aImgMapNames.clear();
     m_aImplicitMarks.clear();
     m_aOutlineMarks.clear();
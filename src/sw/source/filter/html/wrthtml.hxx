@@ -33,6 +33,7 @@
 #include <o3tl/sorted_vector.hxx>
 #include <o3tl/typed_flags_set.hxx>
 #include <rtl/ref.hxx>
+#include <svl/poolitem.hxx>
 #include <svtools/htmlout.hxx>
 #include <tools/fldunit.hxx>
 
@@ -309,6 +310,9 @@ public:
     HTMLControls m_aHTMLControls;     // the forms to be written
     SwHTMLFormatInfos m_CharFormatInfos;
     SwHTMLFormatInfos m_TextCollInfos;
+    // span tags written for character attributes, by Which-Id and script
+    std::map<std::pair<sal_uInt16, sal_uInt16>,
+             std::vector<std::pair<std::unique_ptr<SfxPoolItem>, OString>>> m_aCSS1SpanTags;
     std::vector<SwFormatINetFormat*> m_aINetFormats; // the "open" INet attributes
     std::optional<std::vector<SwTextFootnote*>> m_xFootEndNotes;
 
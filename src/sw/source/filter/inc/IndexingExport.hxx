@@ -19,12 +19,20 @@ class SW_DLLPUBLIC IndexingExport
 {
 private:
     ModelTraverser m_aModelTraverser;
+    SvStream& m_rStream;
     tools::XmlWriter m_aXmlWriter;
 
 public:
     IndexingExport(SvStream& rStream, SwDoc* pDoc);
 
     bool runExport();
+
+    /** Writes a binary inverted index of the document text instead of the XML.
+     *
+     *  For every lowercased word the index lists the paragraphs containing it,
+     *  see sw::search::SearchResultLocator::lookupTerm() for reading it.
+     */
+    bool runTermIndexExport();
 };
 
 } // end sw namespace
@@ -9,6 +9,7 @@
  */
 
 #include <IndexingExport.hxx>
+#include <SearchResultLocator.hxx>
 
 #include <ndtxt.hxx>
 #include <ndole.hxx>
@@ -18,7 +19,11 @@
 #include <editeng/outlobj.hxx>
 #include <editeng/editobj.hxx>
 #include <swtable.hxx>
+#include <swtypes.hxx>
+#include <tools/stream.hxx>
+#include <unotools/charclass.hxx>
 #include <deque>
+#include <map>
 
 namespace sw
 {
@@ -174,10 +179,122 @@ public:
     }
 };
 
+struct TermPosting
+{
+    sw::search::NodeType meType;
+    sal_Int32 mnIndex;
+    sal_uInt32 mnObjectName; // 1-based, 0 if none
+
+    bool operator==(TermPosting const& rOther) const
+    {
+        return meType == rOther.meType && mnIndex == rOther.mnIndex
+               && mnObjectName == rOther.mnObjectName;
+    }
+};
+
+// longer "words" are most likely not something anybody searches for
+constexpr sal_Int32 constMaxTermLength = 100;
+
+class TermIndexNodeHandler : public ModelTraverseHandler
+{
+private:
+    const CharClass& m_rCharClass;
+    // sorted, so that a reader can stop early
+    std::map<OUString, std::vector<TermPosting>> m_aTerms;
+    std::vector<OUString> m_aObjectNames;
+
+    void addTerms(const OUString& rText, TermPosting const& rPosting)
+    {
+        const sal_Int32 nLength = rText.getLength();
+        sal_Int32 nPos = 0;
+        while (nPos < nLength)
+        {
+            while (nPos < nLength && !m_rCharClass.isLetterNumeric(rText, nPos))
+                ++nPos;
+            const sal_Int32 nStart = nPos;
+            while (nPos < nLength && m_rCharClass.isLetterNumeric(rText, nPos))
+                ++nPos;
+            if (nPos == nStart || nPos - nStart > constMaxTermLength)
+                continue;
+
+            std::vector<TermPosting>& rPostings
+                = m_aTerms[m_rCharClass.lowercase(rText, nStart, nPos - nStart)];
+            // a paragraph is listed only once per term
+            if (rPostings.empty() || !(rPostings.back() == rPosting))
+                rPostings.push_back(rPosting);
+        }
+    }
+
+public:
+    TermIndexNodeHandler()
+        : m_rCharClass(GetAppCharClass())
+    {
+    }
+
+    void handleNode(SwNode* pNode) override
+    {
+        if (!pNode->IsTextNode())
+            return;
+
+        const OUString aText = pNode->GetTextNode()->GetText().replaceAll(
+            OUStringChar(CH_TXTATR_BREAKWORD), u"");
+        addTerms(aText, { sw::search::NodeType::WriterNode, sal_Int32(pNode->GetIndex()), 0 });
+    }
+
+    void handleSdrObject(SdrObject* pObject) override
+    {
+        // the locator finds the object by its name
+        if (pObject->GetName().isEmpty())
+            return;
+
+        SdrTextObj* pTextObject = DynCastSdrTextObj(pObject);
+        if (!pTextObject)
+            return;
+
+        OutlinerParaObject* pOutlinerParagraphObject = pTextObject->GetOutlinerParaObject();
+        if (!pOutlinerParagraphObject)
+            return;
+
+        m_aObjectNames.push_back(pObject->GetName());
+        const sal_uInt32 nObjectName = m_aObjectNames.size();
+
+        const EditTextObject& aEdit = pOutlinerParagraphObject->GetTextObject();
+        for (sal_Int32 nParagraph = 0; nParagraph < aEdit.GetParagraphCount(); ++nParagraph)
+            addTerms(aEdit.GetText(nParagraph),
+                     { sw::search::NodeType::CommonNode, nParagraph, nObjectName });
+    }
+
+    bool write(SvStream& rStream) const
+    {
+        rStream.WriteUInt32(sw::search::constTermIndexMagic);
+        rStream.WriteUInt16(sw::search::constTermIndexVersion);
+
+        rStream.WriteUInt32(m_aObjectNames.size());
+        for (const OUString& rName : m_aObjectNames)
+            write_uInt16_lenPrefixed_uInt8s_FromOUString(rStream, rName, RTL_TEXTENCODING_UTF8);
+
+        rStream.WriteUInt32(m_aTerms.size());
+        for (auto const& [rTerm, rPostings] : m_aTerms)
+        {
+            write_uInt16_lenPrefixed_uInt8s_FromOUString(rStream, rTerm, RTL_TEXTENCODING_UTF8);
+            rStream.WriteUInt32(rPostings.size());
+            for (TermPosting const& rPosting : rPostings)
+            {
+                rStream.WriteUChar(sal_uInt8(rPosting.meType));
+                rStream.WriteInt32(rPosting.mnIndex);
+                rStream.WriteUInt32(rPosting.mnObjectName);
+            }
+        }
+
+        return rStream.good();
+    }
+};
+
 } // end anonymous namespace
 
 IndexingExport::IndexingExport(SvStream& rStream, SwDoc* pDoc)
     : m_aModelTraverser(pDoc)
+    , m_rStream(rStream)
     , m_aXmlWriter(&rStream)
 {
 }
@@ -198,6 +315,15 @@ bool IndexingExport::runExport()
     return true;
 }
 
+bool IndexingExport::runTermIndexExport()
+{
+    auto pHandler = std::make_shared<TermIndexNodeHandler>();
+    m_aModelTraverser.addNodeHandler(pHandler);
+    m_aModelTraverser.traverse();
+
+    return pHandler->write(m_rStream);
+}
+
 } // end sw namespace
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
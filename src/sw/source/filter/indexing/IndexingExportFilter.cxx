@@ -41,8 +41,14 @@ sal_Bool IndexingExportFilter::filter(const uno::Sequence<beans::PropertyValue>&
         SwDoc* pDoc = pShell->GetDoc();
         if (pDoc)
         {
+            // "TermIndex" as filter options writes the binary inverted index instead of the XML
+            const OUString aFilterOptions = aMediaDesc.getUnpackedValueOrDefault(
+                utl::MediaDescriptor::PROP_FILTEROPTIONS, OUString());
             IndexingExport aIndexingExport(*pStream, pDoc);
-            bReturn = aIndexingExport.runExport();
+            if (aFilterOptions == "TermIndex")
+                bReturn = aIndexingExport.runTermIndexExport();
+            else
+                bReturn = aIndexingExport.runExport();
         }
     }
 
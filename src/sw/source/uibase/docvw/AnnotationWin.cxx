@@ -320,6 +320,8 @@ void SwAnnotationWin::UpdateData()
         }
         mpField->SetPar2(mpOutliner->GetEditEngine().GetText());
         mpField->SetTextObject(mpOutliner->CreateParaObject());
+        mrView.GetDocShell()->GetDoc()->GetContentChangeStamps().Changed(
+            sw::ContentChange::Fields);
         if (rUndoRedo.DoesUndo())
         {
             SwTextField *const pTextField = mpFormatField->GetTextField();
@@ -185,6 +185,7 @@ class SwContentType final : public SwTypeNumber
     size_t              m_nMemberCount;       // content count
     ContentTypeId       m_nContentType;       // content type's Id
     sal_uInt8           m_nOutlineLevel;
+    sal_uInt64          m_nChangeStamp;       // change counters of the doc when filled
     bool                m_bDataValid :    1;
     bool                m_bEdit:          1;  // can this type be edited?
     bool                m_bDelete:        1;  // can this type be deleted?
@@ -220,6 +221,10 @@ public:
 
         void                Invalidate(); // only nMemberCount is read again
 
+        /** The member list was filled and the parts of the document it is
+            collected from did not change since then */
+        bool                IsUpToDate() const;
+
         bool                IsEditable() const {return m_bEdit;}
         bool                IsDeletable() const {return m_bDelete;}
         bool IsRenamable() const {return m_bRenamable;}
@@ -137,6 +137,8 @@ class SwContentTree final : public SfxListener
 
     bool m_bDocHasChanged = true;
     bool m_bIgnoreDocChange = false; // used to prevent tracking update
+    // sum of the document's change counters when the content was checked last time
+    sal_uInt64 m_nLastChangeStamp = 0;
 
     ImplSVEvent* m_nRowActivateEventId = nullptr;
     bool m_bSelectTo = false;
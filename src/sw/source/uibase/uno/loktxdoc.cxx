@@ -38,6 +38,7 @@
 #include <wrtsh.hxx>
 #include <txtrfmrk.hxx>
 #include <ndtxt.hxx>
+#include <textcachestatistics.hxx>
 
 #include <unoport.hxx>
 #include <unoprnms.hxx>
@@ -527,6 +528,20 @@ void GetSections(tools::JsonWriter& rJsonWriter, SwDocShell* pDocShell,
         rJsonWriter.put("name", pSection->GetName());
     }
 }
+
+/// Implements getCommandValues(".uno:TextCacheStatistics").
+///
+/// The cache of paragraph portions is shared by all documents, so this has no parameters.
+void GetTextCacheStatistics(tools::JsonWriter& rJsonWriter)
+{
+    const sw::TextCacheStatistics aStatistics = sw::GetTextCacheStatistics();
+    auto aStats = rJsonWriter.startNode("textCacheStatistics");
+    rJsonWriter.put("hits", aStatistics.m_nHits);
+    rJsonWriter.put("misses", aStatistics.m_nMisses);
+    rJsonWriter.put("reformats", aStatistics.m_nReformats);
+    rJsonWriter.put("budget", aStatistics.m_nBudget);
+    rJsonWriter.put("maxEntries", aStatistics.m_nMaxEntries);
+}
 }
 
 bool SwXTextDocument::supportsCommand(std::u16string_view rCommand)
@@ -534,7 +549,7 @@ bool SwXTextDocument::supportsCommand(std::u16string_view rCommand)
     static const std::initializer_list<std::u16string_view> vForward
         = { u"TextFormFields", u"TextFormField", u"SetDocumentProperties",
             u"Bookmarks",      u"Fields",        u"Sections",
-            u"Bookmark",       u"Field" };
+            u"Bookmark",       u"Field",         u"TextCacheStatistics" };
 
     return std::find(vForward.begin(), vForward.end(), rCommand) != vForward.end();
 }
@@ -552,6 +567,7 @@ void SwXTextDocument::getCommandValues(tools::JsonWriter& rJsonWriter, std::stri
     static constexpr OStringLiteral aBookmark(".uno:Bookmark");
     static constexpr OStringLiteral aField(".uno:Field");
     static constexpr OStringLiteral aExtractDocStructure(".uno:ExtractDocumentStructure");
+    static constexpr OStringLiteral aTextCacheStatistics(".uno:TextCacheStatistics");
 
     INetURLObject aParser(OUString::fromUtf8(rCommand));
     OUString aArguments = aParser.GetParam();
@@ -610,6 +626,10 @@ void SwXTextDocument::getCommandValues(tools::JsonWriter& rJsonWriter, std::stri
         uno::Reference<container::XIndexAccess> xContentControls = getContentControls();
         GetDocStructure(rJsonWriter, m_pDocShell, aMap, xContentControls);
     }
+    else if (o3tl::starts_with(rCommand, aTextCacheStatistics))
+    {
+        GetTextCacheStatistics(rJsonWriter);
+    }
 }
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
@@ -357,6 +357,62 @@ sal_Int32 getYPos(const SwNode& rNode)
     }
     return sal_Int32(nIndex);
 }
+
+// Sum of the change counters of the document parts the members of a content type are collected
+// from; stays the same as long as the member list does not need to be filled again
+sal_uInt64 lcl_GetChangeStamp(const SwDoc& rDoc, ContentTypeId nType)
+{
+    const sw::ContentChangeStamps& rStamps = rDoc.GetContentChangeStamps();
+    auto lcl_Sum = [&rStamps](std::initializer_list<sw::ContentChange> aChanges)
+    {
+        sal_uInt64 nSum = 0;
+        for (sw::ContentChange eChange : aChanges)
+            nSum += rStamps.Get(eChange);
+        return nSum;
+    };
+
+    using sw::ContentChange;
+    switch (nType)
+    {
+        case ContentTypeId::OUTLINE:
+            return lcl_Sum({ ContentChange::Outline, ContentChange::Nodes, ContentChange::Layout,
+                             ContentChange::Hints, ContentChange::Fields,
+                             ContentChange::Redlines });
+        case ContentTypeId::TABLE:
+        case ContentTypeId::FRAME:
+        case ContentTypeId::GRAPHIC:
+        case ContentTypeId::OLE:
+        case ContentTypeId::REGION:
+        case ContentTypeId::INDEX:
+            return lcl_Sum({ ContentChange::Formats, ContentChange::Nodes,
+                             ContentChange::Layout });
+        case ContentTypeId::BOOKMARK:
+            return lcl_Sum({ ContentChange::Marks });
+        case ContentTypeId::TEXTFIELD:
+            return lcl_Sum({ ContentChange::Fields, ContentChange::Hints, ContentChange::Outline,
+                             ContentChange::Nodes, ContentChange::Layout,
+                             ContentChange::Redlines });
+        case ContentTypeId::FOOTNOTE:
+        case ContentTypeId::ENDNOTE:
+            return lcl_Sum({ ContentChange::OtherText, ContentChange::Hints,
+                             ContentChange::Fields, ContentChange::Nodes,
+                             ContentChange::Layout, ContentChange::Redlines });
+        case ContentTypeId::REFERENCE:
+            return lcl_Sum({ ContentChange::Hints });
+        case ContentTypeId::URLFIELD:
+            return lcl_Sum({ ContentChange::BodyText, ContentChange::OtherText,
+                             ContentChange::Outline, ContentChange::Hints, ContentChange::Nodes,
+                             ContentChange::Layout });
+        case ContentTypeId::POSTIT:
+            return lcl_Sum({ ContentChange::Fields, ContentChange::Hints,
+                             ContentChange::Layout });
+        case ContentTypeId::DRAWOBJECT:
+            return lcl_Sum({ ContentChange::DrawObjects, ContentChange::Formats,
+                             ContentChange::Layout });
+        default:
+            return rStamps.GetTotal();
+    }
+}
 } // end of anonymous namespace
 
 SwContentType::SwContentType(SwWrtShell* pShell, ContentTypeId nType, sal_uInt8 nLevel) :
@@ -367,6 +423,7 @@ SwContentType::SwContentType(SwWrtShell* pShell, ContentTypeId nType, sal_uInt8
     m_nMemberCount(0),
     m_nContentType(nType),
     m_nOutlineLevel(nLevel),
+    m_nChangeStamp(0),
     m_bDataValid(false),
     m_bEdit(false),
     m_bDelete(true)
@@ -474,6 +531,12 @@ void SwContentType::Invalidate()
     m_bDataValid = false;
 }
 
+bool SwContentType::IsUpToDate() const
+{
+    return m_bDataValid && m_pMember
+           && m_nChangeStamp == lcl_GetChangeStamp(*m_pWrtShell->GetDoc(), m_nContentType);
+}
+
 void SwContentType::FillMemberList(bool* pbContentChanged)
 {
     std::unique_ptr<SwContentArr> pOldMember;
@@ -489,6 +552,7 @@ void SwContentType::FillMemberList(bool* pbContentChanged)
         m_pMember.reset( new SwContentArr );
     else
         m_pMember->clear();
+    m_nChangeStamp = lcl_GetChangeStamp(*m_pWrtShell->GetDoc(), m_nContentType);
     switch(m_nContentType)
     {
         case ContentTypeId::OUTLINE   :
@@ -3345,6 +3409,26 @@ bool SwContentTree::HasContentChanged()
         return false;
     }
 
+    // Content types are only filled again if the parts of the document they are collected from
+    // changed. If no change was counted at all since the last time, the change is of a kind that
+    // is not tracked by the counters: check everything then.
+    if (SwWrtShell* pShell = GetWrtShell())
+    {
+        const sal_uInt64 nChangeStamp = pShell->GetDoc()->GetContentChangeStamps().GetTotal();
+        if (nChangeStamp == m_nLastChangeStamp)
+        {
+            for (ContentTypeId i : o3tl::enumrange<ContentTypeId>())
+            {
+                if (m_aActiveContentArr[i])
+                    m_aActiveContentArr[i]->Invalidate();
+            }
+        }
+        m_nLastChangeStamp = nChangeStamp;
+    }
+    o3tl::enumarray<ContentTypeId, bool> aUpToDate;
+    for (ContentTypeId i : o3tl::enumrange<ContentTypeId>())
+        aUpToDate[i] = m_aActiveContentArr[i] && m_aActiveContentArr[i]->IsUpToDate();
+
     // single content type navigation view
     if(m_bIsRoot)
     {
@@ -3359,6 +3443,9 @@ bool SwContentTree::HasContentChanged()
         if (!pArrType)
             return true;
 
+        if (aUpToDate[nType])
+            return false;
+
         pArrType->FillMemberList(&bContentChanged);
         if (bContentChanged)
             return true;
@@ -3418,7 +3505,7 @@ bool SwContentTree::HasContentChanged()
             bool bHasContentChanged = false;
             for (ContentTypeId i : o3tl::enumrange<ContentTypeId>())
             {
-                if (m_aActiveContentArr[i])
+                if (m_aActiveContentArr[i] && !aUpToDate[i])
                 {
                     auto nLastTMCount = m_aActiveContentArr[i]->GetMemberCount();
                     if (i == ContentTypeId::OUTLINE) // this is required for checking if header level is changed
@@ -3461,6 +3548,10 @@ bool SwContentTree::HasContentChanged()
                 continue;
             }
 
+            // nothing to do if the document did not change where the content type is collected from
+            if (aUpToDate[nType])
+                continue;
+
             // all content type member lists must be filled!
             if (bContentChanged)
             {